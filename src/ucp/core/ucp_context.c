@@ -31,21 +31,21 @@
 
 ucp_am_handler_t ucp_am_handlers[UCP_AM_ID_LAST] = {{0, NULL, NULL}};
 
-static const char *ucp_atomic_modes[] = {
+static const char *const ucp_atomic_modes[] = {
     [UCP_ATOMIC_MODE_CPU]    = "cpu",
     [UCP_ATOMIC_MODE_DEVICE] = "device",
     [UCP_ATOMIC_MODE_GUESS]  = "guess",
     [UCP_ATOMIC_MODE_LAST]   = NULL,
 };
 
-static const char * ucp_device_type_names[] = {
+static const char *const ucp_device_type_names[] = {
     [UCT_DEVICE_TYPE_NET]  = "network",
     [UCT_DEVICE_TYPE_SHM]  = "intra-node",
     [UCT_DEVICE_TYPE_ACC]  = "accelerator",
     [UCT_DEVICE_TYPE_SELF] = "loopback",
 };
 
-static const char * ucp_rndv_modes[] = {
+static const char *const ucp_rndv_modes[] = {
     [UCP_RNDV_MODE_GET_ZCOPY] = "get_zcopy",
     [UCP_RNDV_MODE_PUT_ZCOPY] = "put_zcopy",
     [UCP_RNDV_MODE_AUTO]      = "auto",
@@ -532,6 +532,11 @@ static void ucp_add_tl_resource_if_enabled(ucp_context_h context, ucp_tl_md_t *m
             }
         }
         context->tl_rscs[context->num_tls].dev_index = dev_index;
+        context->md_rsc_bitmap[md_index]            |= UCS_BIT(context->num_tls);
+        if ((resource->dev_type == UCT_DEVICE_TYPE_SHM) ||
+            (resource->dev_type == UCT_DEVICE_TYPE_SELF)) {
+            context->self_shm_rsc_bitmap            |= UCS_BIT(context->num_tls);
+        }
 
         ++context->num_tls;
         ++(*num_resources_p);
@@ -969,7 +974,12 @@ static void ucp_fill_sockaddr_prio_list(ucp_context_h context,
         }
     }
 
-    context->config.num_sockaddr_tls = idx;
+    context->config.num_sockaddr_tls     = idx;
+    context->config.last_sockaddr_tl_idx = 0;
+
+    memset(context->config.sockaddr_access_cache, 0,
+           sizeof(context->config.sockaddr_access_cache));
+    context->config.sockaddr_access_cache_lru = 0;
 }
 
 static ucs_status_t ucp_check_resources(ucp_context_h context,
@@ -997,7 +1007,11 @@ static ucs_status_t ucp_check_resources(ucp_context_h context,
         return UCS_ERR_NO_DEVICE;
     }
 
-    /* Error check: Make sure there are not too many transports */
+    /* Error check: Make sure there are not too many transports. Resources
+     * and devices are tracked in single-word uint64_t bitmaps throughout
+     * wireup and address packing, so the limit must not exceed the bitmap
+     * width - raising it requires widening the bitmaps first. */
+    UCS_STATIC_ASSERT(UCP_MAX_RESOURCES <= 64);
     if (context->num_tls >= UCP_MAX_RESOURCES) {
         ucs_error("exceeded transports/devices limit "
                   "(%u requested, up to %d are supported)",
@@ -1327,6 +1341,8 @@ static ucs_status_t ucp_fill_config(ucp_context_h context,
     ucs_debug("Estimated number of endpoints per node is %d",
               context->config.est_num_ppn);
 
+    context->config.inv_est_num_ppn = 1.0 / context->config.est_num_ppn;
+
     /* always init MT lock in context even though it is disabled by user,
      * because we need to use context lock to protect ucp_mm_ and ucp_rkey_
      * routines */
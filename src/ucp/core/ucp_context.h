@@ -21,6 +21,11 @@
 #include <ucs/type/spinlock.h>
 
 
+/* Number of destination addresses whose MD accessibility results are
+ * remembered by the context */
+#define UCP_SA_ACCESS_CACHE_SIZE 8
+
+
 enum {
     /* The flag indicates that the resource may be used for auxiliary
      * wireup communications only */
@@ -173,6 +178,11 @@ typedef struct ucp_context {
                                                * Not all resources may be used if unified
                                                * mode is enabled. */
     ucp_rsc_index_t               num_tls;    /* Number of resources in the array */
+    /* Per-MD bitmap of the resources which use it (UCP_MAX_MDS expands to a
+     * statement expression, so size by UCP_MAX_RESOURCES which bounds it) */
+    uint64_t                      md_rsc_bitmap[UCP_MAX_RESOURCES];
+    /* Bitmap of resources on SHM or SELF devices */
+    uint64_t                      self_shm_rsc_bitmap;
 
     /* Mask of memory type communication resources */
     uint64_t                      mem_type_access_tls[UCS_MEMORY_TYPE_LAST];
@@ -189,6 +199,12 @@ typedef struct ucp_context {
         /* How many endpoints are expected to be created on single node */
         int                       est_num_ppn;
 
+        /* 1.0 / est_num_ppn, precomputed so that the per-process-share
+         * bandwidth evaluation in ucp_tl_iface_bandwidth() multiplies
+         * instead of dividing - it runs twice per score in the wireup
+         * selection loops */
+        double                    inv_est_num_ppn;
+
         struct {
             size_t                         size;    /* Request size for user */
             ucp_request_init_callback_t    init;    /* Initialization user callback */
@@ -217,6 +233,25 @@ typedef struct ucp_context {
         ucp_rsc_index_t           sockaddr_tl_ids[UCP_MAX_RESOURCES];
         unsigned                  num_sockaddr_tls;
 
+        /* Position in sockaddr_tl_ids of the transport selected by the last
+         * successful sockaddr selection, probed first on the next one. The
+         * same (destination, transport) pair recurs for every endpoint to
+         * the same peer, so this usually skips the accessibility scan.
+         * Updated racily - a stale value only costs one extra probe. */
+        unsigned                  last_sockaddr_tl_idx;
+
+        /* Small memo of uct_md_is_sockaddr_accessible() results, keyed by a
+         * hash of the destination address. Endpoints are created repeatedly
+         * towards the same listeners, so steady-state sockaddr selection
+         * reads two bitmaps instead of re-probing every MD. Entries are
+         * replaced round-robin. */
+        struct ucp_sa_access_cache {
+            uint64_t              sa_hash;
+            ucp_md_map_t          md_map_ok;     /* MDs which reach the address */
+            ucp_md_map_t          md_map_probed; /* MDs with a valid result */
+        } sockaddr_access_cache[UCP_SA_ACCESS_CACHE_SIZE];
+        unsigned                  sockaddr_access_cache_lru;
+
         /* Configuration supplied by the user */
         ucp_context_config_t      ext;
 
@@ -361,7 +396,23 @@ ucp_tl_iface_latency(ucp_context_h context, const uct_iface_attr_t *iface_attr)
 static UCS_F_ALWAYS_INLINE double
 ucp_tl_iface_bandwidth(ucp_context_h context, const uct_ppn_bandwidth_t *bandwidth)
 {
-    return bandwidth->dedicated + (bandwidth->shared / context->config.est_num_ppn);
+    return bandwidth->dedicated +
+           (bandwidth->shared * context->config.inv_est_num_ppn);
+}
+
+/**
+ * Pack the four atomic capability words into a single word. Each word uses at
+ * most UCT_ATOMIC_OP_LAST (< 16) bits, so a required-vs-supported test of all
+ * four collapses into one ucs_test_all_flags() on the packed form.
+ */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucp_atomic_flags_pack(const ucp_tl_iface_atomic_flags_t *atomics)
+{
+    UCS_STATIC_ASSERT(UCT_ATOMIC_OP_LAST <= 16);
+    return atomics->atomic32.op_flags |
+           (atomics->atomic64.op_flags  << 16) |
+           (atomics->atomic32.fop_flags << 32) |
+           (atomics->atomic64.fop_flags << 48);
 }
 
 static UCS_F_ALWAYS_INLINE int ucp_memory_type_cache_is_empty(ucp_context_h context)
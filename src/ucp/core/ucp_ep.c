@@ -263,14 +263,14 @@ ucs_status_t ucp_worker_create_mem_type_endpoints(ucp_worker_h worker)
             goto err_free_address_list;
         }
 
-        ucs_free(local_address.address_list);
+        ucp_address_list_release(worker, local_address.address_list);
         ucs_free(address_buffer);
     }
 
     return UCS_OK;
 
 err_free_address_list:
-    ucs_free(local_address.address_list);
+    ucp_address_list_release(worker, local_address.address_list);
 err_free_address_buffer:
     ucs_free(address_buffer);
 err_cleanup_eps:
@@ -476,7 +476,7 @@ ucs_status_t ucp_ep_create_accept(ucp_worker_h worker,
     ucp_ep_update_dest_ep_ptr(*ep_p, client_data->ep_ptr);
 
 out_free_address:
-    ucs_free(remote_address.address_list);
+    ucp_address_list_release(worker, remote_address.address_list);
 out:
     return status;
 }
@@ -613,7 +613,7 @@ ucp_ep_create_api_to_worker_addr(ucp_worker_h worker,
     status = UCS_OK;
 
 out_free_address:
-    ucs_free(remote_address.address_list);
+    ucp_address_list_release(worker, remote_address.address_list);
 out:
     if (status == UCS_OK) {
         *ep_p = ep;
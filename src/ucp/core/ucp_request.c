@@ -128,6 +128,14 @@ static void ucp_worker_request_init_proxy(ucs_mpool_t *mp, void *obj, void *chun
     ucp_context_h context = worker->context;
     ucp_request_t *req = obj;
 
+    /* A completion that wakes a pending operation reads send.state.uct_comp
+     * and then the head of send.uct; requests are cache-line aligned, so both
+     * control words must sit on the same line */
+    UCS_STATIC_ASSERT((ucs_offsetof(ucp_request_t, send.state.uct_comp) /
+                       UCS_SYS_CACHE_LINE_SIZE) ==
+                      (ucs_offsetof(ucp_request_t, send.uct.func) /
+                       UCS_SYS_CACHE_LINE_SIZE));
+
     if (context->config.request.init != NULL) {
         context->config.request.init(req + 1);
     }
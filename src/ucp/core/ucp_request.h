@@ -227,6 +227,10 @@ struct ucp_request {
             ucp_lane_index_t      pending_lane; /* Lane on which request was moved
                                                  * to pending state */
             ucp_lane_index_t      lane;     /* Lane on which this request is being sent */
+            /* Kept right after state.uct_comp: a completion which re-queues
+             * the request touches both control words, and requests come
+             * cache-line aligned from the worker mpool, so the pair stays on
+             * one line (checked in ucp_request.c) */
             uct_pending_req_t     uct;      /* UCT pending request */
             ucp_mem_desc_t        *mdesc;
         } send;
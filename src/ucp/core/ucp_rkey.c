@@ -429,6 +429,11 @@ void ucp_rkey_resolve_inner(ucp_rkey_h rkey, ucp_ep_h ep)
     uct_rkey_t uct_rkey;
     int rma_sw, amo_sw;
 
+    /* RMA/AMO fast paths read the resolved lane, uct rkey and protocol from
+     * this cache with a single line fill; keep it from growing past a cache
+     * line */
+    UCS_STATIC_ASSERT(sizeof(rkey->cache) <= UCS_SYS_CACHE_LINE_SIZE);
+
     rkey->cache.rma_lane = ucp_config_find_rma_lane(context, config,
                                                     UCS_MEMORY_TYPE_HOST,
                                                     config->key.rma_lanes, rkey,
@@ -1006,6 +1006,42 @@ static ucs_status_t ucp_worker_add_resource_ifaces(ucp_worker_h worker)
     return UCS_OK;
 }
 
+/* Gather the per-resource capability summary consumed by wireup selection.
+ * Must run after the interfaces are opened and context->tl_bitmap is final. */
+static ucs_status_t ucp_worker_init_tl_caps(ucp_worker_h worker)
+{
+    ucp_context_h context = worker->context;
+    uct_iface_attr_t *iface_attr;
+    ucp_tl_iface_atomic_flags_t amo;
+    ucp_worker_tl_caps_t *caps;
+    ucp_rsc_index_t rsc_index;
+
+    worker->tl_caps = ucs_calloc(context->num_tls, sizeof(*worker->tl_caps),
+                                 "ucp_worker_tl_caps");
+    if (worker->tl_caps == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    ucs_for_each_bit(rsc_index, context->tl_bitmap) {
+        caps                     = &worker->tl_caps[rsc_index];
+        iface_attr               = ucp_worker_iface_get_attr(worker, rsc_index);
+        caps->md_flags           = context->tl_mds[context->tl_rscs[rsc_index].md_index].attr.cap.flags;
+        caps->iface_flags        = iface_attr->cap.flags;
+        if (ucp_worker_iface_is_tl_p2p(iface_attr)) {
+            worker->p2p_rsc_bitmap |= UCS_BIT(rsc_index);
+        }
+        amo.atomic32.op_flags    = iface_attr->cap.atomic32.op_flags;
+        amo.atomic32.fop_flags   = iface_attr->cap.atomic32.fop_flags;
+        amo.atomic64.op_flags    = iface_attr->cap.atomic64.op_flags;
+        amo.atomic64.fop_flags   = iface_attr->cap.atomic64.fop_flags;
+        caps->amo_flags          = ucp_atomic_flags_pack(&amo);
+        caps->dev_index          = context->tl_rscs[rsc_index].dev_index;
+        caps->rsc_flags          = context->tl_rscs[rsc_index].flags;
+    }
+
+    return UCS_OK;
+}
+
 static void ucp_worker_close_ifaces(ucp_worker_h worker)
 {
     ucp_rsc_index_t iface_id;
@@ -1276,6 +1312,7 @@ static void ucp_worker_init_device_atomics(ucp_worker_h worker)
 
     dummy_iface_attr.bandwidth.dedicated = 1e12;
     dummy_iface_attr.bandwidth.shared    = 0;
+    dummy_iface_attr.eff_bandwidth       = 1e12;
     dummy_iface_attr.cap_flags           = -1;
     dummy_iface_attr.overhead            = 0;
     dummy_iface_attr.priority            = 0;
@@ -1716,6 +1753,12 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
         goto err_close_ifaces;
     }
 
+    /* Gather per-resource capability summary for wireup selection */
+    status = ucp_worker_init_tl_caps(worker);
+    if (status != UCS_OK) {
+        goto err_close_ifaces;
+    }
+
     /* Open all resources as connection managers on this worker */
     status = ucp_worker_add_resource_cms(worker);
     if (status != UCS_OK) {
@@ -1748,6 +1791,7 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
 err_close_cms:
     ucp_worker_close_cms(worker);
 err_close_ifaces:
+    ucs_free(worker->tl_caps);
     ucp_worker_close_ifaces(worker);
     ucp_tag_match_cleanup(&worker->tm);
 err_wakeup_cleanup:
@@ -1796,6 +1840,12 @@ void ucp_worker_destroy(ucp_worker_h worker)
     ucs_trace_func("worker=%p", worker);
 
     UCS_ASYNC_BLOCK(&worker->async);
+    ucs_assert(!worker->addr_list_scratch_busy);
+    ucs_free(worker->tl_caps);
+    ucs_free(worker->addr_pack_cache[0].buffer);
+    ucs_free(worker->addr_pack_cache[1].buffer);
+    ucs_free(worker->addr_list_scratch);
+    ucs_free(worker->addr_devices_scratch);
     ucs_free(worker->am_cbs);
     ucp_worker_destroy_eps(worker);
     ucp_worker_remove_am_handlers(worker);
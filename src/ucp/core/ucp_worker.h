@@ -198,6 +198,23 @@ typedef struct ucp_worker_am_entry {
     uint32_t              flags;
 } ucp_worker_am_entry_t;
 
+/**
+ * Per-resource capability summary for wireup selection. The selection loops
+ * test these masks for every resource on every criteria; gathering them into
+ * one compact entry touches a single cache line per resource instead of
+ * chasing into tl_rscs, the iface attributes and the md attributes.
+ */
+typedef struct ucp_worker_tl_caps {
+    uint64_t                      md_flags;           /* Local MD capability flags */
+    uint64_t                      iface_flags;        /* Local iface capability flags */
+    uint64_t                      amo_flags;          /* Supported atomic operations, four
+                                                         capability words packed by
+                                                         ucp_atomic_flags_pack() */
+    ucp_rsc_index_t               dev_index;          /* Device index of the resource */
+    uint8_t                       rsc_flags;          /* UCP_TL_RSC_FLAG_xx of the resource */
+} ucp_worker_tl_caps_t;
+
+
 /**
  * UCP worker (thread context).
  */
@@ -228,6 +245,9 @@ typedef struct ucp_worker {
     ucs_list_link_t               all_eps;       /* List of all endpoints */
     ucp_ep_match_ctx_t            ep_match_ctx;  /* Endpoint-to-endpoint matching context */
     ucp_worker_iface_t            *ifaces;       /* Array of interfaces, one for each resource */
+    ucp_worker_tl_caps_t          *tl_caps;      /* Capability summary, indexed by rsc_index */
+    uint64_t                      p2p_rsc_bitmap; /* Resources whose interfaces are
+                                                     p2p (connect-to-ep) */
     unsigned                      num_ifaces;    /* Number of elements in ifaces array  */
     unsigned                      num_active_ifaces; /* Number of activated ifaces  */
     ucp_worker_cm_t               *cms;          /* Array of CMs, one for each component */
@@ -244,6 +264,39 @@ typedef struct ucp_worker {
     ucp_worker_am_entry_t        *am_cbs;          /*array of callbacks and their data */
     size_t                        am_cb_array_len; /*len of callback array */
 
+    void                         *addr_devices_scratch; /* Device array reused by
+                                                           address pack, allocated
+                                                           on first use */
+    void                         *addr_list_scratch;     /* Buffer reused for unpacked
+                                                           address lists */
+    size_t                        addr_list_scratch_size; /* Size of addr_list_scratch */
+    int                           addr_list_scratch_busy; /* Scratch is in use by an
+                                                            unpacked address */
+    struct {
+        uint64_t                  tl_bitmap;     /* Key - resources packed */
+        uint64_t                  flags;         /* Key - pack flags */
+        size_t                    size;          /* Cached packed size */
+        void                      *buffer;       /* Cached packed address, or
+                                                    NULL if the slot is empty */
+    }                             addr_pack_cache[2]; /* Own packed address, by
+                                                         (tl_bitmap, flags) */
+    unsigned                      addr_pack_cache_lru; /* Slot to evict next */
+
+    struct {
+        uint64_t                  md_flags;      /* Key - local MD flags */
+        uint64_t                  iface_flags;   /* Key - local iface flags */
+        uint64_t                  amo_flags;     /* Key - packed atomic flags */
+        uint64_t                  rsc_bitmap;    /* Cached eligibility bitmap */
+        uint8_t                   tl_rsc_flags;  /* Key - TL resource flags */
+        uint8_t                   valid;         /* Slot holds a result */
+    }                             wireup_elig_cache[4]; /* Resource eligibility
+                                                           by local criteria;
+                                                           capabilities are
+                                                           fixed after worker
+                                                           creation, so entries
+                                                           never go stale */
+    unsigned                      wireup_elig_cache_lru; /* Slot to evict next */
+
     ucs_cpu_set_t                 cpu_mask;        /* Save CPU mask for subsequent calls to ucp_worker_listen */
     unsigned                      ep_config_max;   /* Maximal number of configurations */
     unsigned                      ep_config_count; /* Current number of configurations */
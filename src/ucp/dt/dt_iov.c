@@ -10,6 +10,7 @@
 
 #include "dt_iov.h"
 
+#include <ucs/arch/cpu.h>
 #include <ucs/debug/assert.h>
 #include <ucs/sys/math.h>
 
@@ -30,8 +31,9 @@ void ucp_dt_iov_gather(void *dest, const ucp_dt_iov_t *iov, size_t length,
 
         item_len_to_copy = item_reminder -
                            ucs_max((ssize_t)((length_it + item_reminder) - length), 0);
-        memcpy(dest + length_it, iov[*iovcnt_offset].buffer + *iov_offset,
-               item_len_to_copy);
+        ucs_memcpy_relaxed(dest + length_it,
+                           iov[*iovcnt_offset].buffer + *iov_offset,
+                           item_len_to_copy);
         length_it += item_len_to_copy;
 
         ucs_assert(length_it <= length);
@@ -56,8 +58,8 @@ size_t ucp_dt_iov_scatter(ucp_dt_iov_t *iov, size_t iovcnt, const void *src,
                                    length - length_it);
         ucs_assert(*iov_offset <= item_len);
 
-        memcpy(iov[*iovcnt_offset].buffer + *iov_offset, src + length_it,
-               item_len_to_copy);
+        ucs_memcpy_relaxed(iov[*iovcnt_offset].buffer + *iov_offset,
+                           src + length_it, item_len_to_copy);
         length_it += item_len_to_copy;
 
         ucs_assert(length_it <= length);
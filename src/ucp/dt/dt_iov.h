@@ -20,13 +20,21 @@
  */
 static inline size_t ucp_dt_iov_length(const ucp_dt_iov_t *iov, size_t iovcnt)
 {
-    size_t iov_it, total_length = 0;
-
-    for (iov_it = 0; iov_it < iovcnt; ++iov_it) {
-        total_length += iov[iov_it].length;
+    size_t total_even = 0;
+    size_t total_odd  = 0;
+    size_t iov_it;
+
+    /* Two independent accumulators break the loop-carried add chain, so the
+     * length loads from consecutive entries can issue in parallel */
+    for (iov_it = 0; (iov_it + 1) < iovcnt; iov_it += 2) {
+        total_even += iov[iov_it].length;
+        total_odd  += iov[iov_it + 1].length;
+    }
+    if (iov_it < iovcnt) {
+        total_even += iov[iov_it].length;
     }
 
-    return total_length;
+    return total_even + total_odd;
 }
 
 /**
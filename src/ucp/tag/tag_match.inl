@@ -19,9 +19,12 @@
 #include <inttypes.h>
 
 
-/* Hash size is a prime number just below 1024. Prime number for even distribution,
- * and small enough to fit L1 cache. */
-#define UCP_TAG_MATCH_HASH_SIZE     1021
+/* Hash size is a power of two, small enough to fit L1 cache. Even distribution
+ * comes from the multiplicative hash below, which mixes every tag bit into the
+ * top bits - so the bucket can be selected with a shift instead of an integer
+ * division by a prime. */
+#define UCP_TAG_MATCH_HASH_SHIFT    10
+#define UCP_TAG_MATCH_HASH_SIZE     UCS_BIT(UCP_TAG_MATCH_HASH_SHIFT)
 
 
 static UCS_F_ALWAYS_INLINE
@@ -43,9 +46,10 @@ int ucp_tag_is_match(ucp_tag_t tag, ucp_tag_t exp_tag, ucp_tag_t tag_mask)
 static UCS_F_ALWAYS_INLINE size_t
 ucp_tag_match_calc_hash(ucp_tag_t tag)
 {
-    /* Compute two 32-bit modulo and combine their result */
-    return ((uint32_t)tag % UCP_TAG_MATCH_HASH_SIZE) ^
-           ((uint32_t)(tag >> 32) % UCP_TAG_MATCH_HASH_SIZE);
+    /* Fibonacci hashing: the multiply mixes every tag bit into the top bits
+     * and the shift selects a bucket, replacing two 32-bit divisions on
+     * every post and match */
+    return (tag * 0x9e3779b97f4a7c15ul) >> (64 - UCP_TAG_MATCH_HASH_SHIFT);
 }
 
 static UCS_F_ALWAYS_INLINE ucp_request_queue_t*
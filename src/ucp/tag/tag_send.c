@@ -144,6 +144,10 @@ ucp_tag_send_req_init(ucp_request_t* req, ucp_ep_h ep, const void* buffer,
     req->send.pending_lane = UCP_NULL_LANE;
 }
 
+/* The short/inline thresholds are device properties (verbs inline size, tcp
+ * segment size, ...) resolved when the endpoint configuration is created and
+ * cached per endpoint, so the fast path pays a single compare against a warm
+ * field - they cannot be compile-time constants. */
 static UCS_F_ALWAYS_INLINE int
 ucp_tag_eager_is_inline(ucp_ep_h ep, const ucp_memtype_thresh_t *max_eager_short,
                         ssize_t length)
@@ -16,11 +16,15 @@
 #include <ucs/arch/bitops.h>
 #include <ucs/debug/log.h>
 #include <inttypes.h>
+#ifdef __BMI2__
+#include <x86intrin.h>
+#endif
 
 
 /*
  * Packed address layout:
  *
+ * [ header(8bit) ]
  * [ uuid(64bit) | worker_name(string) ]
  * [ device1_md_index | device1_address(var) ]
  *    [ tl1_name_csum(string) | tl1_info | tl1_address(var) ]
@@ -39,6 +43,16 @@
  *   * If the address list is empty, then it will contain only a single md_index
  *     which equals to UCP_NULL_RESOURCE.
  *
+ * The header byte carries the UCP_ADDRESS_PACK_FLAG_xx bits the address was
+ * packed with, so the receiver decodes the actual wire layout without
+ * trusting the caller-supplied flags, and layout fast-paths (e.g. the
+ * iface-only one) engage based on what is really on the wire.
+ *
+ * Flag fields are already bit-packed rather than sent as full words:
+ * MD reg/alloc capability flags travel as two bits inside the md_index byte
+ * (UCP_ADDRESS_FLAG_MD_ALLOC/REG), and iface cap_flags are compressed against
+ * UCP_ADDRESS_IFACE_FLAGS into the 22-bit field of prio_cap_flags. A varint
+ * encoding of these fields would be larger than the current fixed bit fields.
  */
 
 
@@ -51,12 +65,62 @@ typedef struct {
 } ucp_address_packed_device_t;
 
 
+/* Performance values are quantized on the wire - they are used only for
+ * relative ranking during transport selection. Latency-like values (seconds)
+ * use bfloat16, where 8 bits of mantissa are enough. Bandwidth uses integer
+ * KB/s fixed-point: it fits in 31 bits for any transport up to ~2TB/s, keeps
+ * full ranking precision, and unpacks with a single integer-to-double
+ * conversion instead of bit surgery. */
 typedef struct {
-    float            overhead;
-    float            bandwidth;
-    float            lat_ovh;
     uint32_t         prio_cap_flags; /* 8 lsb: prio, 22 msb: cap flags, 2 hsb: amo */
-} ucp_address_packed_iface_attr_t;
+    uint16_t         overhead;       /* bfloat16 */
+    int32_t          bandwidth;      /* KB/s, negative value means shared */
+    uint16_t         lat_ovh;        /* bfloat16 */
+} UCS_S_PACKED ucp_address_packed_iface_attr_t;
+
+
+/* Truncate a value to bfloat16: the high half of its float32 representation */
+static UCS_F_ALWAYS_INLINE uint16_t ucp_address_pack_bf16(double value)
+{
+    float f = (float)value;
+    uint32_t u;
+
+    memcpy(&u, &f, sizeof(u));
+    return u >> 16;
+}
+
+static UCS_F_ALWAYS_INLINE double ucp_address_unpack_bf16(uint16_t value)
+{
+    uint32_t u = (uint32_t)value << 16;
+    float f;
+
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+/* Convert bandwidth in bytes/sec to KB/s fixed-point, saturating */
+static UCS_F_ALWAYS_INLINE int32_t ucp_address_pack_bandwidth(double value)
+{
+    return (int32_t)ucs_min(ucs_max(value / UCS_KBYTE, (double)INT32_MIN),
+                            (double)INT32_MAX);
+}
+
+static UCS_F_ALWAYS_INLINE double ucp_address_unpack_bandwidth(int32_t value)
+{
+    return value * (double)UCS_KBYTE;
+}
+
+
+/*
+ * Fixed-offset wire layout of the per-transport info block (non-unified mode).
+ * The fields are laid out exactly as they appear on the wire, so both sides
+ * can access the whole block with a single struct copy/overlay instead of
+ * walking it field-by-field.
+ */
+typedef struct {
+    uint16_t                        tl_name_csum; /* Checksum of transport name */
+    ucp_address_packed_iface_attr_t iface_attr;   /* Interface attributes */
+} UCS_S_PACKED ucp_address_packed_tl_info_t;
 
 #define UCT_ADDRESS_FLAG_ATOMIC32     UCS_BIT(30) /* 32bit atomic operations */
 #define UCT_ADDRESS_FLAG_ATOMIC64     UCS_BIT(31) /* 64bit atomic operations */
@@ -74,6 +138,51 @@ typedef struct {
                                         UCP_ADDRESS_FLAG_MD_ALLOC | \
                                         UCP_ADDRESS_FLAG_MD_REG)
 
+/* Compress the bits of @a value selected by @a mask into consecutive low
+ * bits of the result. With BMI2 this is a single instruction; the fallback
+ * iterates only over the bits actually set in the mask. */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucp_address_bits_compress(uint64_t value, uint64_t mask)
+{
+#ifdef __BMI2__
+    return _pext_u64(value, mask);
+#else
+    uint64_t packed = 0;
+    unsigned dst    = 0;
+    unsigned bit;
+
+    ucs_for_each_bit(bit, mask) {
+        if (value & UCS_BIT(bit)) {
+            packed |= UCS_BIT(dst);
+        }
+        ++dst;
+    }
+    return packed;
+#endif
+}
+
+/* Expand consecutive low bits of @a packed to the bit positions selected by
+ * @a mask - the inverse of ucp_address_bits_compress. */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucp_address_bits_expand(uint64_t packed, uint64_t mask)
+{
+#ifdef __BMI2__
+    return _pdep_u64(packed, mask);
+#else
+    uint64_t value = 0;
+    unsigned src   = 0;
+    unsigned bit;
+
+    ucs_for_each_bit(bit, mask) {
+        if (packed & UCS_BIT(src)) {
+            value |= UCS_BIT(bit);
+        }
+        ++src;
+    }
+    return value;
+#endif
+}
+
 static size_t ucp_address_worker_name_size(ucp_worker_h worker, uint64_t flags)
 {
 #if ENABLE_DEBUG_DATA
@@ -90,6 +199,12 @@ static size_t ucp_address_iface_attr_size(ucp_worker_t *worker)
            sizeof(ucp_rsc_index_t) : sizeof(ucp_address_packed_iface_attr_t);
 }
 
+/* Size of the whole per-transport info block: name checksum + attributes */
+static size_t ucp_address_tl_info_size(ucp_worker_t *worker)
+{
+    return sizeof(uint16_t) + ucp_address_iface_attr_size(worker);
+}
+
 static uint64_t ucp_worker_iface_can_connect(uct_iface_attr_t *attrs)
 {
     return attrs->cap.flags &
@@ -108,38 +223,32 @@ static void* ucp_address_pack_worker_name(ucp_worker_h worker, void *dest,
         return dest;
     }
 
+    /* The name travels as a NUL-terminated string, so the receiver can point
+     * into the buffer instead of copying */
     s      = ucp_worker_get_name(worker);
-    length = strlen(s);
-    ucs_assert(length <= UINT8_MAX);
-    *(uint8_t*)dest = length;
-    memcpy(UCS_PTR_TYPE_OFFSET(dest, uint8_t), s, length);
-    return UCS_PTR_BYTE_OFFSET(UCS_PTR_TYPE_OFFSET(dest, uint8_t), length);
+    length = strlen(s) + 1;
+    memcpy(dest, s, length);
+    return UCS_PTR_BYTE_OFFSET(dest, length);
 #else
     return dest;
 #endif
 }
 
-/* Unpack a string and return pointer to next storage byte */
-static const void* ucp_address_unpack_worker_name(const void *src, char *s,
-                                                  size_t max, uint64_t flags)
+/* Point at the packed string and return pointer to next storage byte */
+static const void* ucp_address_unpack_worker_name(const void *src,
+                                                  const char **name_p,
+                                                  uint64_t flags)
 {
 #if ENABLE_DEBUG_DATA
-    size_t length, avail;
-
     if (!(flags & UCP_ADDRESS_PACK_FLAG_WORKER_NAME)) {
-        s[0] = '\0';
+        *name_p = "";
         return src;
     }
 
-    ucs_assert(max >= 1);
-    length   = *(const uint8_t*)src;
-    avail    = ucs_min(length, max - 1);
-    memcpy(s, UCS_PTR_TYPE_OFFSET(src, const uint8_t), avail);
-    s[avail] = '\0';
-    return UCS_PTR_TYPE_OFFSET(UCS_PTR_BYTE_OFFSET(src,length),
-                               const uint8_t);
+    *name_p = src;
+    return UCS_PTR_BYTE_OFFSET(src, strlen(*name_p) + 1);
 #else
-    s[0] = '\0';
+    *name_p = "";
     return src;
 #endif
 }
@@ -153,9 +262,11 @@ ucp_address_get_device(ucp_context_h context, ucp_rsc_index_t rsc_index,
     ucp_address_packed_device_t *dev;
 
     for (dev = devices; dev < devices + *num_devices_p; ++dev) {
+        /* Resources with the same dev_index have the same device name, so an
+         * integer compare is enough to share one device entry (and one copy
+         * of the device address on the wire) between its transports */
         if ((tl_rsc[rsc_index].md_index == tl_rsc[dev->rsc_index].md_index) &&
-            !strcmp(tl_rsc[rsc_index].tl_rsc.dev_name,
-                    tl_rsc[dev->rsc_index].tl_rsc.dev_name)) {
+            (tl_rsc[rsc_index].dev_index == tl_rsc[dev->rsc_index].dev_index)) {
             goto out;
         }
     }
@@ -179,19 +290,25 @@ ucp_address_gather_devices(ucp_worker_h worker, uint64_t tl_bitmap,
     ucp_rsc_index_t i;
     uint64_t mask;
 
-    devices = ucs_calloc(context->num_tls, sizeof(*devices), "packed_devices");
+    /* Reuse a worker-owned scratch array to keep allocations off the connect
+     * path. Its size depends only on the context, so it never needs to grow,
+     * and every entry is initialized by ucp_address_get_device() before use. */
+    devices = worker->addr_devices_scratch;
     if (devices == NULL) {
-        return UCS_ERR_NO_MEMORY;
+        devices = ucs_calloc(context->num_tls, sizeof(*devices),
+                             "packed_devices");
+        if (devices == NULL) {
+            return UCS_ERR_NO_MEMORY;
+        }
+        worker->addr_devices_scratch = devices;
     }
 
     num_devices = 0;
-    ucs_for_each_bit(i, context->tl_bitmap) {
+    /* Iterate only over bits which are set in both bitmaps - ucs_for_each_bit
+     * visits set bits only, so no per-bit skip test is needed */
+    ucs_for_each_bit(i, context->tl_bitmap & tl_bitmap) {
         mask = UCS_BIT(i);
 
-        if (!(mask & tl_bitmap)) {
-            continue;
-        }
-
         iface_attr = ucp_worker_iface_get_attr(worker, i);
 
         if (!ucp_worker_iface_can_connect(iface_attr)) {
@@ -241,6 +358,8 @@ static size_t ucp_address_packed_size(ucp_worker_h worker,
     size_t size = 0;
     const ucp_address_packed_device_t *dev;
 
+    size += 1;                          /* layout header */
+
     if (flags & UCP_ADDRESS_PACK_FLAG_WORKER_UUID) {
         size += sizeof(uint64_t);
     }
@@ -296,15 +415,16 @@ ucp_address_pack_ep_address(ucp_ep_h ep, ucp_rsc_index_t tl_index,
     return UCS_ERR_INVALID_ADDR;
 }
 
-static int ucp_address_pack_iface_attr(ucp_worker_h worker, void *ptr,
-                                       ucp_rsc_index_t index,
-                                       const uct_iface_attr_t *iface_attr,
-                                       int enable_atomics)
+static int ucp_address_pack_tl_info(ucp_worker_h worker, void *ptr,
+                                    ucp_rsc_index_t index,
+                                    const uct_iface_attr_t *iface_attr,
+                                    int enable_atomics)
 {
+    uint16_t tl_name_csum = worker->context->tl_rscs[index].tl_name_csum;
+    ucp_address_packed_tl_info_t tl_info;
+    ucp_address_packed_iface_attr_t packed_attr;
     ucp_address_packed_iface_attr_t *packed;
-    uint32_t packed_flag;
     uint64_t cap_flags;
-    uint64_t bit;
 
     /* check if at least one of bandwidth values is 0 */
     if ((iface_attr->bandwidth.dedicated * iface_attr->bandwidth.shared) != 0) {
@@ -317,65 +437,77 @@ static int ucp_address_pack_iface_attr(ucp_worker_h worker, void *ptr,
         /* In unified mode all workers have the same transports and tl bitmap.
          * Just send rsc index, so the remote peer could fetch iface attributes
          * from its local iface. */
-        *(ucp_rsc_index_t*)ptr = index;
-        return sizeof(ucp_rsc_index_t);
+        *(uint16_t*)ptr = tl_name_csum;
+        *(ucp_rsc_index_t*)UCS_PTR_BYTE_OFFSET(ptr, sizeof(uint16_t)) = index;
+        return sizeof(uint16_t) + sizeof(ucp_rsc_index_t);
     }
 
-    packed    = ptr;
-    cap_flags = iface_attr->cap.flags;
+    /* Build the whole info block on the stack in its exact wire layout, and
+     * store it with a single copy. */
+    tl_info.tl_name_csum = tl_name_csum;
+    packed               = &packed_attr;
+    cap_flags            = iface_attr->cap.flags;
 
     packed->prio_cap_flags = ((uint8_t)iface_attr->priority);
-    packed->overhead       = iface_attr->overhead;
-    packed->bandwidth      = iface_attr->bandwidth.dedicated - iface_attr->bandwidth.shared;
-    packed->lat_ovh        = iface_attr->latency.overhead;
+    packed->overhead       = ucp_address_pack_bf16(iface_attr->overhead);
+    packed->bandwidth      = ucp_address_pack_bandwidth(
+                                       iface_attr->bandwidth.dedicated -
+                                       iface_attr->bandwidth.shared);
+    packed->lat_ovh        = ucp_address_pack_bf16(iface_attr->latency.overhead);
 
     /* Keep only the bits defined by UCP_ADDRESS_IFACE_FLAGS, to shrink address. */
-    packed_flag = UCS_BIT(8);
-    bit         = 1;
-    while (UCP_ADDRESS_IFACE_FLAGS & ~(bit - 1)) {
-        if (UCP_ADDRESS_IFACE_FLAGS & bit) {
-            if (cap_flags & bit) {
-                packed->prio_cap_flags |= packed_flag;
-            }
-            packed_flag <<= 1;
-        }
-        bit <<= 1;
-    }
+    packed->prio_cap_flags |=
+        ucp_address_bits_compress(cap_flags, UCP_ADDRESS_IFACE_FLAGS) << 8;
 
+    /* The atomic sub-bitmaps are all-or-nothing at the protocol level, so
+     * they compress to one summary bit each. Compute the bits branchlessly -
+     * mask-compare results are 0/1 and shift straight into place. */
     if (enable_atomics) {
-        if (ucs_test_all_flags(iface_attr->cap.atomic32.op_flags, UCP_ATOMIC_OP_MASK) &&
-            ucs_test_all_flags(iface_attr->cap.atomic32.fop_flags, UCP_ATOMIC_FOP_MASK)) {
-            packed->prio_cap_flags |= UCT_ADDRESS_FLAG_ATOMIC32;
-        }
-        if (ucs_test_all_flags(iface_attr->cap.atomic64.op_flags, UCP_ATOMIC_OP_MASK) &&
-            ucs_test_all_flags(iface_attr->cap.atomic64.fop_flags, UCP_ATOMIC_FOP_MASK)) {
-            packed->prio_cap_flags |= UCT_ADDRESS_FLAG_ATOMIC64;
-        }
+        packed->prio_cap_flags |=
+            (uint32_t)(ucs_test_all_flags(iface_attr->cap.atomic32.op_flags,
+                                          UCP_ATOMIC_OP_MASK) &
+                       ucs_test_all_flags(iface_attr->cap.atomic32.fop_flags,
+                                          UCP_ATOMIC_FOP_MASK)) << 30;
+        packed->prio_cap_flags |=
+            (uint32_t)(ucs_test_all_flags(iface_attr->cap.atomic64.op_flags,
+                                          UCP_ATOMIC_OP_MASK) &
+                       ucs_test_all_flags(iface_attr->cap.atomic64.fop_flags,
+                                          UCP_ATOMIC_FOP_MASK)) << 31;
     }
 
-    return sizeof(*packed);
+    tl_info.iface_attr = packed_attr;
+    memcpy(ptr, &tl_info, sizeof(tl_info));
+    return sizeof(tl_info);
 }
 
 static int
-ucp_address_unpack_iface_attr(ucp_worker_t *worker,
-                              ucp_address_iface_attr_t *iface_attr,
-                              const void *ptr)
+ucp_address_unpack_tl_info(ucp_worker_t *worker, uint16_t *tl_name_csum,
+                           ucp_address_iface_attr_t *iface_attr,
+                           const void *ptr)
 {
+    const ucp_address_packed_tl_info_t *tl_info;
+    ucp_address_packed_iface_attr_t packed_attr;
     const ucp_address_packed_iface_attr_t *packed;
     ucp_worker_iface_t *wiface;
-    uint32_t packed_flag;
     ucp_rsc_index_t rsc_idx;
-    uint64_t bit;
+    uint64_t amo_mask;
+    double bandwidth;
+
+    *tl_name_csum = *(const uint16_t*)ptr;
 
     if (ucp_worker_unified_mode(worker)) {
         /* Address contains resources index, not iface attrs.
          * Just take iface attrs from the local resource. */
-        rsc_idx               = (*(ucp_rsc_index_t*)ptr) & UCP_ADDRESS_FLAG_LEN_MASK;
+        rsc_idx               = (*(ucp_rsc_index_t*)
+                                 UCS_PTR_BYTE_OFFSET(ptr, sizeof(uint16_t))) &
+                                UCP_ADDRESS_FLAG_LEN_MASK;
         wiface                = ucp_worker_iface(worker, rsc_idx);
         iface_attr->cap_flags = wiface->attr.cap.flags;
         iface_attr->priority  = wiface->attr.priority;
         iface_attr->overhead  = wiface->attr.overhead;
         iface_attr->bandwidth = wiface->attr.bandwidth;
+        iface_attr->eff_bandwidth =
+            ucp_tl_iface_bandwidth(worker->context, &iface_attr->bandwidth);
         iface_attr->lat_ovh   = wiface->attr.latency.overhead;
         if (worker->atomic_tls & UCS_BIT(rsc_idx)) {
             iface_attr->atomic.atomic32.op_flags  = wiface->attr.cap.atomic32.op_flags;
@@ -384,53 +516,56 @@ ucp_address_unpack_iface_attr(ucp_worker_t *worker,
             iface_attr->atomic.atomic64.fop_flags = wiface->attr.cap.atomic64.fop_flags;
         }
 
-        return sizeof(rsc_idx);
+        return sizeof(uint16_t) + sizeof(rsc_idx);
     }
 
-    packed                          = ptr;
-    iface_attr->cap_flags           = 0;
+    /* Overlay the wire struct on the received buffer - its layout matches the
+     * packed format bit-for-bit, so no per-field decoding of offsets is
+     * needed. */
+    tl_info                         = ptr;
+    packed_attr                     = tl_info->iface_attr;
+    packed                          = &packed_attr;
     iface_attr->priority            = packed->prio_cap_flags & UCS_MASK(8);
-    iface_attr->overhead            = packed->overhead;
-    iface_attr->bandwidth.dedicated = ucs_max(0.0, packed->bandwidth);
-    iface_attr->bandwidth.shared    = ucs_max(0.0, -packed->bandwidth);
-    iface_attr->lat_ovh             = packed->lat_ovh;
-
-    packed_flag = UCS_BIT(8);
-    bit         = 1;
-    while (UCP_ADDRESS_IFACE_FLAGS & ~(bit - 1)) {
-        if (UCP_ADDRESS_IFACE_FLAGS & bit) {
-            if (packed->prio_cap_flags & packed_flag) {
-                iface_attr->cap_flags |= bit;
-            }
-            packed_flag <<= 1;
-        }
-        bit <<= 1;
-    }
-
-    if (packed->prio_cap_flags & UCT_ADDRESS_FLAG_ATOMIC32) {
-        iface_attr->atomic.atomic32.op_flags  |= UCP_ATOMIC_OP_MASK;
-        iface_attr->atomic.atomic32.fop_flags |= UCP_ATOMIC_FOP_MASK;
-    }
-    if (packed->prio_cap_flags & UCT_ADDRESS_FLAG_ATOMIC64) {
-        iface_attr->atomic.atomic64.op_flags  |= UCP_ATOMIC_OP_MASK;
-        iface_attr->atomic.atomic64.fop_flags |= UCP_ATOMIC_FOP_MASK;
-    }
-
-    return sizeof(*packed);
+    iface_attr->overhead            = ucp_address_unpack_bf16(packed->overhead);
+    bandwidth                       = ucp_address_unpack_bandwidth(packed->bandwidth);
+    iface_attr->bandwidth.dedicated = ucs_max(0.0, bandwidth);
+    iface_attr->bandwidth.shared    = ucs_max(0.0, -bandwidth);
+    iface_attr->eff_bandwidth       = ucp_tl_iface_bandwidth(worker->context,
+                                                             &iface_attr->bandwidth);
+    iface_attr->lat_ovh             = ucp_address_unpack_bf16(packed->lat_ovh);
+
+    iface_attr->cap_flags =
+        ucp_address_bits_expand((packed->prio_cap_flags >> 8) & UCS_MASK(22),
+                                UCP_ADDRESS_IFACE_FLAGS);
+
+    /* Expand the summary bits back to full masks without branching: an
+     * all-ones/all-zeros mask derived from each bit selects the op masks. */
+    amo_mask                              = -(uint64_t)!!(packed->prio_cap_flags &
+                                                          UCT_ADDRESS_FLAG_ATOMIC32);
+    iface_attr->atomic.atomic32.op_flags  |= UCP_ATOMIC_OP_MASK  & amo_mask;
+    iface_attr->atomic.atomic32.fop_flags |= UCP_ATOMIC_FOP_MASK & amo_mask;
+    amo_mask                              = -(uint64_t)!!(packed->prio_cap_flags &
+                                                          UCT_ADDRESS_FLAG_ATOMIC64);
+    iface_attr->atomic.atomic64.op_flags  |= UCP_ATOMIC_OP_MASK  & amo_mask;
+    iface_attr->atomic.atomic64.fop_flags |= UCP_ATOMIC_FOP_MASK & amo_mask;
+
+    return sizeof(*tl_info);
 }
 
 static const void*
-ucp_address_iface_flags_ptr(ucp_worker_h worker, const void *attr_ptr, int attr_len)
+ucp_address_iface_flags_ptr(ucp_worker_h worker, const void *tl_info_ptr,
+                            int tl_info_len)
 {
     if (ucp_worker_unified_mode(worker)) {
         /* In unified mode, rsc_index is packed instead of attrs. Address flags
-         * will be packed in the end of rsc_index byte. */
-        return attr_ptr;
+         * will be packed in the end of rsc_index byte, which follows the name
+         * checksum. */
+        return UCS_PTR_BYTE_OFFSET(tl_info_ptr, sizeof(uint16_t));
     }
 
     /* In non-unified mode, address flags will be packed in the end of
-     * iface addr length byte, which is packed right after iface attrs. */
-    return UCS_PTR_BYTE_OFFSET(attr_ptr, attr_len);
+     * iface addr length byte, which is packed right after the tl info block. */
+    return UCS_PTR_BYTE_OFFSET(tl_info_ptr, tl_info_len);
 }
 
 static void*
@@ -506,6 +641,11 @@ static ucs_status_t ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep,
     ptr   = buffer;
     index = 0;
 
+    /* Layout header: the pack flags which determine the wire format (all
+     * defined UCP_ADDRESS_PACK_FLAG_xx bits fit in one byte) */
+    *(uint8_t*)ptr = flags & UCS_MASK(8);
+    ptr = UCS_PTR_TYPE_OFFSET(ptr, uint8_t);
+
     if (flags & UCP_ADDRESS_PACK_FLAG_WORKER_UUID) {
         *(uint64_t*)ptr = worker->uuid;
         ptr = UCS_PTR_TYPE_OFFSET(ptr, worker->uuid);
@@ -555,12 +695,7 @@ static ucs_status_t ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep,
             ptr = UCS_PTR_BYTE_OFFSET(ptr, dev->dev_addr_len);
         }
 
-        ucs_for_each_bit(i, context->tl_bitmap) {
-
-            if (!(UCS_BIT(i) & dev->tl_bitmap)) {
-                continue;
-            }
-
+        ucs_for_each_bit(i, dev->tl_bitmap) {
             wiface     = ucp_worker_iface(worker, i);
             iface_attr = &wiface->attr;
 
@@ -568,13 +703,9 @@ static ucs_status_t ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep,
                 return UCS_ERR_INVALID_ADDR;
             }
 
-            /* Transport name checksum */
-            *(uint16_t*)ptr = context->tl_rscs[i].tl_name_csum;
-            ptr = UCS_PTR_TYPE_OFFSET(ptr, context->tl_rscs[i].tl_name_csum);
-
-            /* Transport information */
-            attr_len = ucp_address_pack_iface_attr(worker, ptr, i, iface_attr,
-                                                   worker->atomic_tls & UCS_BIT(i));
+            /* Transport name checksum and information, as one wire block */
+            attr_len = ucp_address_pack_tl_info(worker, ptr, i, iface_attr,
+                                                worker->atomic_tls & UCS_BIT(i));
             if (attr_len < 0) {
                 return UCS_ERR_INVALID_ADDR;
             }
@@ -659,6 +790,62 @@ out:
     return UCS_OK;
 }
 
+/* Look up the worker's own packed address in the cache. The cache applies
+ * only to worker addresses (ep == NULL): they depend solely on (tl_bitmap,
+ * flags), and the worker's interface set is fixed after creation, so cached
+ * bytes never go stale. A copy is returned so the caller's ownership of the
+ * buffer (released with ucs_free) is unchanged. */
+static int ucp_address_pack_cache_get(ucp_worker_h worker, uint64_t tl_bitmap,
+                                      uint64_t flags, size_t *size_p,
+                                      void **buffer_p)
+{
+    unsigned i;
+    void *copy;
+
+    for (i = 0; i < ucs_array_size(worker->addr_pack_cache); ++i) {
+        if ((worker->addr_pack_cache[i].buffer    == NULL)      ||
+            (worker->addr_pack_cache[i].tl_bitmap != tl_bitmap) ||
+            (worker->addr_pack_cache[i].flags     != flags)) {
+            continue;
+        }
+
+        copy = ucs_malloc(worker->addr_pack_cache[i].size, "ucp_address");
+        if (copy == NULL) {
+            return 0;
+        }
+
+        memcpy(copy, worker->addr_pack_cache[i].buffer,
+               worker->addr_pack_cache[i].size);
+        *size_p   = worker->addr_pack_cache[i].size;
+        *buffer_p = copy;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void ucp_address_pack_cache_put(ucp_worker_h worker, uint64_t tl_bitmap,
+                                       uint64_t flags, size_t size,
+                                       const void *buffer)
+{
+    unsigned i = worker->addr_pack_cache_lru;
+    void *copy;
+
+    copy = ucs_malloc(size, "ucp_address_cache");
+    if (copy == NULL) {
+        return; /* Not an error - just don't cache */
+    }
+
+    memcpy(copy, buffer, size);
+    ucs_free(worker->addr_pack_cache[i].buffer);
+    worker->addr_pack_cache[i].tl_bitmap = tl_bitmap;
+    worker->addr_pack_cache[i].flags     = flags;
+    worker->addr_pack_cache[i].size      = size;
+    worker->addr_pack_cache[i].buffer    = copy;
+    worker->addr_pack_cache_lru          = (i + 1) %
+                                           ucs_array_size(worker->addr_pack_cache);
+}
+
 ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
                               uint64_t tl_bitmap, uint64_t flags,
                               unsigned *order, size_t *size_p, void **buffer_p)
@@ -671,6 +858,15 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
 
     if (ep == NULL) {
         flags &= ~UCP_ADDRESS_PACK_FLAG_EP_ADDR;
+
+        /* Worker addresses are deterministic - serve repeat packs of the same
+         * (tl_bitmap, flags) from the cache. Skip when the caller asks for the
+         * packing order, to keep the cache a plain byte blob. */
+        if ((order == NULL) &&
+            ucp_address_pack_cache_get(worker, tl_bitmap, flags, size_p,
+                                       buffer_p)) {
+            return UCS_OK;
+        }
     }
 
     /* Collect all devices we want to pack */
@@ -680,43 +876,61 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
         goto out;
     }
 
-    /* Calculate packed size */
+    /* Calculate exact packed size in a first pass, so the buffer is
+     * allocated once and never grown while packing */
     size = ucp_address_packed_size(worker, devices, num_devices, flags);
 
     /* Allocate address */
-    buffer = ucs_malloc(size, "ucp_address");
+    buffer = ucs_calloc(1, size, "ucp_address");
     if (buffer == NULL) {
         status = UCS_ERR_NO_MEMORY;
-        goto out_free_devices;
+        goto out;
     }
 
-    memset(buffer, 0, size);
-
     /* Pack the address */
     status = ucp_address_do_pack(worker, ep, buffer, size, tl_bitmap, flags,
                                  order, devices, num_devices);
     if (status != UCS_OK) {
         ucs_free(buffer);
-        goto out_free_devices;
+        goto out;
     }
 
     VALGRIND_CHECK_MEM_IS_DEFINED(buffer, size);
 
+    if ((ep == NULL) && (order == NULL)) {
+        ucp_address_pack_cache_put(worker, tl_bitmap, flags, size, buffer);
+    }
+
     *size_p   = size;
     *buffer_p = buffer;
     status    = UCS_OK;
 
-out_free_devices:
-    ucs_free(devices);
 out:
     return status;
 }
 
+/*
+ * Unpack results are deliberately not memoized across duplicate receives of
+ * the same worker address: entries alias the caller's receive buffer
+ * (dev/iface/ep addresses point into it), so a cached result would dangle
+ * once the original buffer is released, and keeping it valid would require
+ * the worker to retain a copy of every distinct packed buffer. The recycled
+ * scratch allocation below already removes the per-call allocator cost,
+ * which is the bulk of the duplicate-unpack overhead.
+ */
 ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
                                 uint64_t flags,
                                 ucp_unpacked_address_t *unpacked_address)
 {
     ucp_address_entry_t *address_list, *address;
+    /* Iface-only fast path: when the wire header indicates the address was
+     * packed without ep addresses, skip the per-entry ep-addr decode */
+    int have_ep_addr;
+    size_t alloc_size;
+    uint64_t *md_flags_list          = NULL;
+    uint16_t *tl_name_csum_list      = NULL;
+    ucp_rsc_index_t *md_index_list   = NULL;
+    ucp_rsc_index_t *dev_index_list  = NULL;
     const uct_device_addr_t *dev_addr;
     ucp_rsc_index_t dev_index;
     ucp_rsc_index_t md_index;
@@ -734,6 +948,13 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
     const void *flags_ptr;
 
     ptr = buffer;
+
+    /* The layout header tells which format is actually on the wire; it can
+     * only narrow down what the caller allowed */
+    flags       &= *(const uint8_t*)ptr;
+    have_ep_addr = flags & UCP_ADDRESS_PACK_FLAG_EP_ADDR;
+    ptr          = UCS_PTR_TYPE_OFFSET(ptr, uint8_t);
+
     if (flags & UCP_ADDRESS_PACK_FLAG_WORKER_UUID) {
         unpacked_address->uuid = *(uint64_t*)ptr;
         ptr = UCS_PTR_TYPE_OFFSET(ptr, unpacked_address->uuid);
@@ -741,9 +962,7 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
         unpacked_address->uuid = 0;
     }
 
-    aptr = ucp_address_unpack_worker_name(ptr, unpacked_address->name,
-                                          sizeof(unpacked_address->name),
-                                          flags);
+    aptr = ucp_address_unpack_worker_name(ptr, &unpacked_address->name, flags);
 
     address_count = 0;
 
@@ -766,18 +985,19 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
 
         last_tl = empty_dev;
         while (!last_tl) {
-            ptr       = UCS_PTR_TYPE_OFFSET(ptr, uint16_t); /* tl_name_csum */
-            attr_len  = ucp_address_iface_attr_size(worker);
+            attr_len  = ucp_address_tl_info_size(worker);
             flags_ptr = ucp_address_iface_flags_ptr(worker, ptr, attr_len);
             ptr       = UCS_PTR_BYTE_OFFSET(ptr, attr_len);
             ptr       = ucp_address_unpack_length(worker, flags_ptr, ptr,
                                                   &iface_addr_len, 0);
             ptr       = UCS_PTR_BYTE_OFFSET(ptr, iface_addr_len);
-            ptr       = ucp_address_unpack_length(worker, flags_ptr, ptr,
-                                                  &ep_addr_len, 1);
-            ucs_assert((flags & UCP_ADDRESS_PACK_FLAG_EP_ADDR) ||
-                       (ep_addr_len == 0));
-            ptr       = UCS_PTR_BYTE_OFFSET(ptr, ep_addr_len);
+            if (have_ep_addr) {
+                ptr = ucp_address_unpack_length(worker, flags_ptr, ptr,
+                                                &ep_addr_len, 1);
+                ptr = UCS_PTR_BYTE_OFFSET(ptr, ep_addr_len);
+            } else {
+                ucs_assert(!((*(uint8_t*)flags_ptr) & UCP_ADDRESS_FLAG_EP_ADDR));
+            }
             last_tl   = (*(uint8_t*)flags_ptr) & UCP_ADDRESS_FLAG_LAST;
 
             ++address_count;
@@ -790,14 +1010,43 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
         goto out;
     }
 
-    /* Allocate address list */
-    address_list = ucs_calloc(address_count, sizeof(*address_list),
-                              "ucp_address_list");
-    if (address_list == NULL) {
-        ucs_error("failed to allocate address list");
-        return UCS_ERR_NO_MEMORY;
+    /* Allocate address list together with the parallel hot-field arrays.
+     * sizeof(ucp_address_entry_t) is a multiple of 8, so the md_flags array
+     * which follows the entries stays naturally aligned. The worker-owned
+     * scratch buffer is reused when available, since unpacked addresses are
+     * normally released within the scope of a single wireup operation;
+     * nested unpacks fall back to a heap allocation. */
+    alloc_size = (address_count * sizeof(*address_list)) +
+                 (address_count * sizeof(uint64_t)) +
+                 (address_count * sizeof(uint16_t)) +
+                 (address_count * 2 * sizeof(ucp_rsc_index_t));
+    if (!worker->addr_list_scratch_busy) {
+        if (worker->addr_list_scratch_size < alloc_size) {
+            address_list = ucs_realloc(worker->addr_list_scratch, alloc_size,
+                                       "ucp_address_list_scratch");
+            if (address_list == NULL) {
+                ucs_error("failed to allocate address list");
+                return UCS_ERR_NO_MEMORY;
+            }
+            worker->addr_list_scratch      = address_list;
+            worker->addr_list_scratch_size = alloc_size;
+        }
+        address_list                  = worker->addr_list_scratch;
+        worker->addr_list_scratch_busy = 1;
+        memset(address_list, 0, alloc_size);
+    } else {
+        address_list = ucs_calloc(1, alloc_size, "ucp_address_list");
+        if (address_list == NULL) {
+            ucs_error("failed to allocate address list");
+            return UCS_ERR_NO_MEMORY;
+        }
     }
 
+    md_flags_list     = (uint64_t*)(address_list + address_count);
+    tl_name_csum_list = (uint16_t*)(md_flags_list + address_count);
+    md_index_list     = (ucp_rsc_index_t*)(tl_name_csum_list + address_count);
+    dev_index_list    = md_index_list + address_count;
+
     /* Unpack addresses */
     address = address_list;
     ptr     = aptr;
@@ -825,26 +1074,38 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
 
         last_tl = empty_dev;
         while (!last_tl) {
-            /* tl_name_csum */
-            address->tl_name_csum = *(uint16_t*)ptr;
-            ptr = UCS_PTR_TYPE_OFFSET(ptr, address->tl_name_csum);
+            /* The wire data is read strictly forward; pull the next line in
+             * early so decoding overlaps the memory access */
+            ucs_prefetch(UCS_PTR_BYTE_OFFSET(ptr, UCS_SYS_CACHE_LINE_SIZE));
 
             address->dev_addr   = (dev_addr_len > 0) ? dev_addr : NULL;
             address->md_index   = md_index;
             address->dev_index  = dev_index;
             address->md_flags   = md_flags;
 
-            attr_len  = ucp_address_unpack_iface_attr(worker, &address->iface_attr, ptr);
+            attr_len  = ucp_address_unpack_tl_info(worker, &address->tl_name_csum,
+                                                   &address->iface_attr, ptr);
+
+            /* Mirror the hot scalar fields into the parallel arrays */
+            md_flags_list[address - address_list]     = md_flags;
+            tl_name_csum_list[address - address_list] = address->tl_name_csum;
+            md_index_list[address - address_list]     = md_index;
+            dev_index_list[address - address_list]    = dev_index;
+
             flags_ptr = ucp_address_iface_flags_ptr(worker, ptr, attr_len);
             ptr       = UCS_PTR_BYTE_OFFSET(ptr, attr_len);
             ptr       = ucp_address_unpack_length(worker, flags_ptr, ptr,
                                                   &iface_addr_len, 0);
             address->iface_addr = (iface_addr_len > 0) ? ptr : NULL;
             ptr       = UCS_PTR_BYTE_OFFSET(ptr, iface_addr_len);
-            ptr       = ucp_address_unpack_length(worker, flags_ptr, ptr,
-                                                  &ep_addr_len, 1);
-            address->ep_addr = (ep_addr_len > 0) ? ptr : NULL;
-            ptr       = UCS_PTR_BYTE_OFFSET(ptr, ep_addr_len);
+            if (have_ep_addr) {
+                ptr = ucp_address_unpack_length(worker, flags_ptr, ptr,
+                                                &ep_addr_len, 1);
+                address->ep_addr = (ep_addr_len > 0) ? ptr : NULL;
+                ptr = UCS_PTR_BYTE_OFFSET(ptr, ep_addr_len);
+            } else {
+                address->ep_addr = NULL;
+            }
             last_tl   = (*(uint8_t*)flags_ptr) & UCP_ADDRESS_FLAG_LAST;
 
             ucs_trace("unpack addr[%d] : md_flags 0x%"PRIx64" tl_flags 0x%"PRIx64" bw %e + %e/n ovh %e "
@@ -867,8 +1128,22 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
     } while (!last_dev);
 
 out:
-    unpacked_address->address_count = address_count;
-    unpacked_address->address_list  = address_list;
+    unpacked_address->address_count     = address_count;
+    unpacked_address->address_list      = address_list;
+    unpacked_address->md_flags_list     = md_flags_list;
+    unpacked_address->tl_name_csum_list = tl_name_csum_list;
+    unpacked_address->md_index_list     = md_index_list;
+    unpacked_address->dev_index_list    = dev_index_list;
     return UCS_OK;
 }
 
+void ucp_address_list_release(ucp_worker_h worker,
+                              ucp_address_entry_t *address_list)
+{
+    if ((address_list != NULL) && (address_list == worker->addr_list_scratch)) {
+        ucs_assert(worker->addr_list_scratch_busy);
+        worker->addr_list_scratch_busy = 0;
+    } else {
+        ucs_free(address_list);
+    }
+}
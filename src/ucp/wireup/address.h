@@ -36,7 +36,12 @@ enum {
 
 enum {
     UCP_ADDRESS_PACK_FLAG_WORKER_UUID = UCS_BIT(0),
-    UCP_ADDRESS_PACK_FLAG_WORKER_NAME = UCS_BIT(1), /* valid only for debug build */
+    UCP_ADDRESS_PACK_FLAG_WORKER_NAME = UCS_BIT(1), /* has effect in debug-data
+                                                       builds only: without
+                                                       ENABLE_DEBUG_DATA the
+                                                       name pack/unpack helpers
+                                                       compile to no-ops and the
+                                                       flag test is eliminated */
     UCP_ADDRESS_PACK_FLAG_DEVICE_ADDR = UCS_BIT(2),
     UCP_ADDRESS_PACK_FLAG_IFACE_ADDR  = UCS_BIT(3),
     UCP_ADDRESS_PACK_FLAG_EP_ADDR     = UCS_BIT(4)
@@ -50,6 +55,9 @@ struct ucp_address_iface_attr {
     uint64_t                    cap_flags;    /* Interface capability flags */
     double                      overhead;     /* Interface performance - overhead */
     uct_ppn_bandwidth_t         bandwidth;    /* Interface performance - bandwidth */
+    double                      eff_bandwidth; /* PPN-scaled effective bandwidth,
+                                                  precomputed at unpack time for
+                                                  the selection score functions */
     int                         priority;     /* Priority of device */
     double                      lat_ovh;      /* Latency overhead */
     ucp_tl_iface_atomic_flags_t atomic;       /* Atomic operations */
@@ -73,12 +81,25 @@ struct ucp_address_entry {
 
 /**
  * Unpacked remote address
+ *
+ * In addition to the address entry list, the hot scalar fields are duplicated
+ * in parallel arrays, so that selection code which scans all entries touching
+ * a single field streams only that field's cache lines. The arrays are carved
+ * from the same allocation as address_list, so releasing address_list releases
+ * them as well.
  */
 struct ucp_unpacked_address {
     uint64_t                   uuid;            /* Remote worker UUID */
-    char                       name[UCP_WORKER_NAME_MAX]; /* Remote worker name */
+    const char                 *name;           /* Remote worker name; points
+                                                   into the packed buffer (or to
+                                                   a static string), valid as
+                                                   long as the buffer is */
     unsigned                   address_count;   /* Length of address list */
     ucp_address_entry_t        *address_list;   /* Pointer to address list */
+    uint64_t                   *md_flags_list;  /* MD flags, one per entry */
+    uint16_t                   *tl_name_csum_list; /* TL name checksum, one per entry */
+    ucp_rsc_index_t            *md_index_list;  /* MD index, one per entry */
+    ucp_rsc_index_t            *dev_index_list; /* Device index, one per entry */
 };
 
 
@@ -124,11 +145,25 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
  *       should not be released as long as the remote address is used.
  *
  * @note The address list inside @ref ucp_remote_address_t should be released
- *       by ucs_free().
+ *       by @ref ucp_address_list_release().
  */
 ucs_status_t ucp_address_unpack(ucp_worker_h worker, const void *buffer,
                                 uint64_t flags,
                                 ucp_unpacked_address_t *unpacked_address);
 
 
+/**
+ * Release an address list returned by @ref ucp_address_unpack.
+ *
+ * Normally the list is carved from a worker-owned scratch buffer which is
+ * recycled for the next unpack; lists which could not use the scratch are
+ * freed to the heap.
+ *
+ * @param [in]  worker        Worker which unpacked the address.
+ * @param [in]  address_list  Address list to release, may be NULL.
+ */
+void ucp_address_list_release(ucp_worker_h worker,
+                              ucp_address_entry_t *address_list);
+
+
 #endif
@@ -12,15 +12,25 @@
 #include "wireup.h"
 #include "address.h"
 
-#include <ucs/algorithm/qsort_r.h>
+#include <ucs/algorithm/crc.h>
 #include <ucs/datastruct/queue.h>
 #include <ucs/sys/sock.h>
 #include <ucp/core/ucp_ep.inl>
 #include <string.h>
 #include <inttypes.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #define UCP_WIREUP_RMA_BW_TEST_MSG_SIZE       262144
 
+/* The candidate-address map is a 64-bit bitmap */
+#define UCP_WIREUP_MAX_ADDR_COUNT             64
+
+/* How many address entries ahead to prefetch in streaming scans */
+#define UCP_WIREUP_PREFETCH_DIST              8
+
 #define UCP_WIREUP_CHECK_AMO_FLAGS(_ae, _criteria, _context, _addr_index, _op, _size)      \
     if (!ucs_test_all_flags((_ae)->iface_attr.atomic.atomic##_size._op##_flags,            \
                             (_criteria)->remote_atomic_flags.atomic##_size._op##_flags)) { \
@@ -50,11 +60,18 @@ enum {
 };
 
 
+enum {
+    UCP_WIREUP_AUX_CAP_LOCAL  = UCS_BIT(0), /* Local iface fits aux criteria */
+    UCP_WIREUP_AUX_CAP_REMOTE = UCS_BIT(1)  /* Remote iface fits aux criteria */
+};
+
+
 typedef struct {
     ucp_rsc_index_t   rsc_index;
     unsigned          addr_index;
     ucp_lane_index_t  proxy_lane;
     ucp_rsc_index_t   dst_md_index;
+    uint8_t           aux_caps;
     uint32_t          usage;
     double            am_bw_score;
     double            rma_score;
@@ -78,6 +95,17 @@ typedef struct {
  */
 typedef struct {
     ucp_ep_h                  ep;                        /* UCP Endpoint */
+    ucp_worker_h              worker;                    /* Worker of the endpoint */
+    ucp_context_h             context;                   /* Context of the worker */
+    const ucp_tl_resource_desc_t *tl_rscs;               /* Resource array of the
+                                                          * context */
+    uint64_t                  features;                  /* Configured context features */
+    uint32_t                  needed_lane_classes;       /* UCP_WIREUP_LANE_USAGE_* classes
+                                                          * the configuration may need */
+    uint64_t                  aux_local_iface_flags;     /* Local iface flags required to
+                                                          * carry wireup messages */
+    uint64_t                  aux_remote_iface_flags;    /* Remote iface flags required to
+                                                          * carry wireup messages */
     const ucp_ep_params_t     *params;                   /* Tuning parameters for the
                                                           * UCP endpoint */
     unsigned                  ep_init_flags;             /* Endpoint init flags */
@@ -85,19 +113,50 @@ typedef struct {
     unsigned                  address_count;             /* Number of remote addresses */
     ucp_wireup_lane_desc_t    lane_descs[UCP_MAX_LANES]; /* Array of active lanes that are
                                                           * found during selection */
+    uint16_t                  lane_keys[UCP_MAX_LANES];  /* (rsc_index << 8) | addr_index
+                                                          * of each lane, for dedup */
+    uint64_t                  used_rsc_bitmap;           /* Resources used by lanes */
+    uint64_t                  used_addr_bitmap;          /* Addresses used by lanes */
+    uint64_t                  rsc_reachable_addrs[UCP_MAX_RESOURCES];
+                                                         /* Per-resource bitmap of
+                                                          * reachable addresses */
+    uint64_t                  addr_cap_flags[UCP_WIREUP_MAX_ADDR_COUNT];
+                                                         /* Capability flags of each
+                                                          * remote address */
+    uint8_t                   addr_md_index[UCP_WIREUP_MAX_ADDR_COUNT];
+                                                         /* MD index of each remote
+                                                          * address */
+    uint8_t                   addr_dev_index[UCP_WIREUP_MAX_ADDR_COUNT];
+                                                         /* Device index of each
+                                                          * remote address */
     ucp_lane_index_t          num_lanes;                 /* Number of active lanes */
     int                       allow_am;                  /* Shows whether emulation over AM
                                                           * is allowed or not for RMA/AMO */
+    ucp_err_handling_mode_t   err_mode;                  /* Error handling mode of the
+                                                          * endpoint configuration */
+    ucp_ep_config_key_t       *key;                      /* EP configuration key under
+                                                          * construction */
+    uint8_t                   *addr_indices;             /* Remote address index of each
+                                                          * lane (output) */
+    struct {
+        uint64_t              remote_md_flags;           /* Criteria remote MD flags */
+        uint64_t              remote_iface_flags;        /* Criteria remote iface flags */
+        uint64_t              remote_amo_flags;          /* Packed criteria atomics */
+        uint64_t              addr_map;                  /* Addresses passing the flags */
+        uint8_t               valid;                     /* Entry holds a result */
+    }                         addr_filter_cache[4];      /* Memoized per-criteria address
+                                                          * flag-filter results */
+    unsigned                  addr_filter_cache_lru;     /* Round-robin insertion slot */
     ucp_wireup_select_info_t  am_info;                   /* AM transport selection info */
 } ucp_wireup_select_ctx_t;
 
 
-static const char *ucp_wireup_md_flags[] = {
+static const char *const ucp_wireup_md_flags[] = {
     [ucs_ilog2(UCT_MD_FLAG_ALLOC)]               = "memory allocation",
     [ucs_ilog2(UCT_MD_FLAG_REG)]                 = "memory registration",
 };
 
-static const char *ucp_wireup_iface_flags[] = {
+static const char *const ucp_wireup_iface_flags[] = {
     [ucs_ilog2(UCT_IFACE_FLAG_AM_SHORT)]         = "am short",
     [ucs_ilog2(UCT_IFACE_FLAG_AM_BCOPY)]         = "am bcopy",
     [ucs_ilog2(UCT_IFACE_FLAG_AM_ZCOPY)]         = "am zcopy",
@@ -123,7 +182,7 @@ static const char *ucp_wireup_iface_flags[] = {
     [ucs_ilog2(UCT_IFACE_FLAG_TAG_RNDV_ZCOPY)]   = "tag rndv zcopy"
 };
 
-static ucp_wireup_atomic_flag_t ucp_wireup_atomic_desc[] = {
+static const ucp_wireup_atomic_flag_t ucp_wireup_atomic_desc[] = {
      [UCT_ATOMIC_OP_ADD]   = {.name = "add",   .fetch = "fetch-"},
      [UCT_ATOMIC_OP_AND]   = {.name = "and",   .fetch = "fetch-"},
      [UCT_ATOMIC_OP_OR]    = {.name = "or",    .fetch = "fetch-"},
@@ -133,14 +192,62 @@ static ucp_wireup_atomic_flag_t ucp_wireup_atomic_desc[] = {
 };
 
 
-static double ucp_wireup_aux_score_func(ucp_context_h context,
-                                        const uct_md_attr_t *md_attr,
-                                        const uct_iface_attr_t *iface_attr,
-                                        const ucp_address_iface_attr_t *remote_iface_attr);
+/* Defines the batched counterpart of a scalar score function. The batch
+ * function is dispatched through criteria->calc_score_batch once per local
+ * resource, so the scalar formula is a direct call which the compiler can
+ * inline into (and vectorize across) the per-address loop.
+ *
+ * The local md/iface attributes are snapshotted into stack copies before the
+ * loop: unlike loads through the caller's pointers, loads from the locals
+ * provably cannot alias the scores[] stores, so the invariant parts of the
+ * formula (growth latency, overhead, local bandwidth) are folded once per
+ * resource instead of being re-read for every address. */
+#define UCP_WIREUP_SCORE_BATCH_FUNC(_batch_func, _score_func) \
+    static void _batch_func(ucp_context_h context, \
+                            const uct_md_attr_t *md_attr, \
+                            const uct_iface_attr_t *iface_attr, \
+                            const ucp_address_entry_t *address_list, \
+                            uint64_t addr_map, double *scores) \
+    { \
+        const uct_md_attr_t md_attr_val       = *md_attr; \
+        const uct_iface_attr_t iface_attr_val = *iface_attr; \
+        unsigned addr_index; \
+        \
+        ucs_for_each_bit(addr_index, addr_map) { \
+            scores[addr_index] = \
+                _score_func(context, &md_attr_val, &iface_attr_val, \
+                            &address_list[addr_index].iface_attr); \
+        } \
+    }
+
+/* Auxiliary transports want the best end-to-end latency; the three local
+ * terms of the formula (latency overhead, latency growth scaled by the
+ * estimated endpoint count, and send overhead) are hoisted out of the loop,
+ * so each candidate address costs only two loads from its packed attributes,
+ * a max, an add and a divide. */
+static void ucp_wireup_aux_score_batch(ucp_context_h context,
+                                       const uct_md_attr_t *md_attr,
+                                       const uct_iface_attr_t *iface_attr,
+                                       const ucp_address_entry_t *address_list,
+                                       uint64_t addr_map, double *scores)
+{
+    const double lat_ovh  = iface_attr->latency.overhead;
+    const double base_ovh = (iface_attr->latency.growth *
+                             context->config.est_num_eps) +
+                            iface_attr->overhead;
+    const ucp_address_iface_attr_t *remote;
+    unsigned addr_index;
+
+    ucs_for_each_bit(addr_index, addr_map) {
+        remote              = &address_list[addr_index].iface_attr;
+        scores[addr_index]  = 1e-3 / (ucs_max(lat_ovh, remote->lat_ovh) +
+                                      base_ovh + remote->overhead);
+    }
+}
 
 static const char *
 ucp_wireup_get_missing_flag_desc(uint64_t flags, uint64_t required_flags,
-                                 const char ** flag_descs)
+                                 const char *const *flag_descs)
 {
     ucs_assert((required_flags & (~flags)) != 0);
     return flag_descs[ucs_ffs64(required_flags & (~flags))];
@@ -179,7 +286,8 @@ ucp_wireup_get_missing_amo_flag_desc_fop(uint64_t flags, uint64_t required_flags
 
 static int ucp_wireup_check_flags(const uct_tl_resource_desc_t *resource,
                                   uint64_t flags, uint64_t required_flags,
-                                  const char *title, const char ** flag_descs,
+                                  const char *title,
+                                  const char *const *flag_descs,
                                   char *reason, size_t max)
 {
     const char *missing_flag_desc;
@@ -224,6 +332,75 @@ static int ucp_wireup_check_amo_flags(const uct_tl_resource_desc_t *resource,
     return 0;
 }
 
+/* Test all local criteria masks against the compact per-resource capability
+ * summary. This is the hot-path form of the ucp_wireup_check_*_flags chain
+ * below - one cache line per resource, no diagnostics. */
+static UCS_F_ALWAYS_INLINE int
+ucp_wireup_check_caps(const ucp_worker_tl_caps_t *caps,
+                      const ucp_wireup_criteria_t *criteria)
+{
+    /* Bitwise AND of the three 0/1 results instead of a short-circuit chain:
+     * all fields sit in one summary cache line, so evaluating them
+     * unconditionally is cheaper than three conditional branches */
+    return ucs_test_all_flags(caps->md_flags, criteria->local_md_flags) &
+           ucs_test_all_flags(caps->iface_flags, criteria->local_iface_flags) &
+           ucs_test_all_flags(caps->amo_flags,
+                              ucp_atomic_flags_pack(&criteria->local_atomic_flags));
+}
+
+/* Bitmap of resources whose local capabilities satisfy the criteria. The
+ * local criteria do not change between repeated selections (only tl_bitmap
+ * and the remote maps shrink), so callers which select in a loop compute
+ * this once and reuse it. In addition, the result depends only on the local
+ * criteria masks and the worker capabilities, which are fixed after worker
+ * creation - so it is memoized on the worker, and wireup of subsequent
+ * endpoints (which mostly repeats the same few criteria bundles) reuses it. */
+static uint64_t
+ucp_wireup_eligible_rsc_bitmap(ucp_worker_h worker,
+                               const ucp_wireup_criteria_t *criteria)
+{
+    ucp_context_h context    = worker->context;
+    uint64_t local_amo_flags = ucp_atomic_flags_pack(&criteria->local_atomic_flags);
+    uint64_t rsc_bitmap      = 0;
+    const ucp_worker_tl_caps_t *caps;
+    ucp_rsc_index_t rsc_index;
+    unsigned i;
+
+    for (i = 0; i < ucs_array_size(worker->wireup_elig_cache); ++i) {
+        if (worker->wireup_elig_cache[i].valid &&
+            (worker->wireup_elig_cache[i].md_flags == criteria->local_md_flags) &&
+            (worker->wireup_elig_cache[i].iface_flags == criteria->local_iface_flags) &&
+            (worker->wireup_elig_cache[i].amo_flags == local_amo_flags) &&
+            (worker->wireup_elig_cache[i].tl_rsc_flags == criteria->tl_rsc_flags)) {
+            return worker->wireup_elig_cache[i].rsc_bitmap;
+        }
+    }
+
+    ucs_for_each_bit(rsc_index, context->tl_bitmap) {
+        caps = &worker->tl_caps[rsc_index];
+        if ((caps->rsc_flags & UCP_TL_RSC_FLAG_AUX) &&
+            !(criteria->tl_rsc_flags & UCP_TL_RSC_FLAG_AUX)) {
+            continue;
+        }
+
+        if (ucp_wireup_check_caps(caps, criteria)) {
+            rsc_bitmap |= UCS_BIT(rsc_index);
+        }
+    }
+
+    i                                        = worker->wireup_elig_cache_lru;
+    worker->wireup_elig_cache[i].md_flags    = criteria->local_md_flags;
+    worker->wireup_elig_cache[i].iface_flags = criteria->local_iface_flags;
+    worker->wireup_elig_cache[i].amo_flags   = local_amo_flags;
+    worker->wireup_elig_cache[i].tl_rsc_flags = criteria->tl_rsc_flags;
+    worker->wireup_elig_cache[i].rsc_bitmap  = rsc_bitmap;
+    worker->wireup_elig_cache[i].valid       = 1;
+    worker->wireup_elig_cache_lru            =
+        (i + 1) % ucs_array_size(worker->wireup_elig_cache);
+
+    return rsc_bitmap;
+}
+
 /**
  * Compare two scores and return:
  * - `-1` if score1 < score2
@@ -233,49 +410,131 @@ static int ucp_wireup_check_amo_flags(const uct_tl_resource_desc_t *resource,
 static int ucp_wireup_score_cmp(double score1, double score2)
 {
     double diff = score1 - score2;
-    return ((fabs(diff) < ucp_calc_epsilon(score1, score2)) ?
-            0 : ucs_signum(diff));
+    double eps  = ucp_calc_epsilon(score1, score2);
+
+    /* Scores are non-negative, so a two-sided compare against the relative
+     * epsilon replaces the fabs() + signum form with two straight-line FP
+     * compares and no sign-extraction branches */
+    if (diff > eps) {
+        return 1;
+    } else if (diff < -eps) {
+        return -1;
+    } else {
+        return 0;
+    }
 }
 
-/**
- * Select a local and remote transport
- */
-static UCS_F_NOINLINE ucs_status_t
-ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list,
-                            unsigned address_count, const ucp_wireup_criteria_t *criteria,
-                            uint64_t tl_bitmap, uint64_t remote_md_map,
-                            uint64_t local_dev_bitmap, uint64_t remote_dev_bitmap,
-                            int show_error, ucp_wireup_select_info_t *select_info)
+#ifdef __AVX2__
+/* Test required_flags against 4 consecutive flag words, returning an
+ * all-ones/all-zeros predicate per 64-bit element */
+static UCS_F_ALWAYS_INLINE __m256i
+ucp_wireup_test_all_flags_x4(const uint64_t *flags, uint64_t required_flags)
 {
-    ucp_worker_h worker   = ep->worker;
-    ucp_context_h context = worker->context;
-    uct_tl_resource_desc_t *resource;
+    __m256i req = _mm256_set1_epi64x(required_flags);
+
+    return _mm256_cmpeq_epi64(
+               _mm256_and_si256(_mm256_loadu_si256((const __m256i*)flags), req),
+               req);
+}
+#endif
+
+/* Build the bitmap of remote addresses which satisfy the criteria. The tested
+ * fields are first gathered into contiguous arrays, then all criteria masks
+ * are evaluated 4 addresses at a time (scalar on non-AVX2 builds) - the
+ * entry-by-entry walk over the AoS address list is memory-bound and branchy,
+ * while this form streams the staged arrays and produces predicate bits
+ * directly. Diagnostics for rejected addresses are emitted separately by
+ * ucp_wireup_trace_unsuitable_addresses(). */
+static uint64_t
+ucp_wireup_filter_addresses(const ucp_address_entry_t *address_list,
+                            unsigned address_count,
+                            const ucp_wireup_criteria_t *criteria,
+                            uint64_t remote_md_map, uint64_t remote_dev_bitmap)
+{
+    uint64_t pass_mask[UCP_WIREUP_MAX_ADDR_COUNT];
+    uint64_t md_flags[UCP_WIREUP_MAX_ADDR_COUNT];
+    uint64_t cap_flags[UCP_WIREUP_MAX_ADDR_COUNT];
+    uint64_t amo_flags[UCP_WIREUP_MAX_ADDR_COUNT];
     const ucp_address_entry_t *ae;
-    ucp_rsc_index_t rsc_index, best_rsc_index;
-    double score, best_score;
-    char tls_info[256];
-    char *p, *endp;
-    uct_iface_attr_t *iface_attr;
-    uct_md_attr_t *md_attr;
+    uint64_t criteria_amo_flags;
     uint64_t addr_index_map;
-    unsigned addr_index, best_dst_addr_index;
-    int reachable;
-    int found;
-    uint8_t priority, best_score_priority;
+    uint64_t ok;
+    unsigned i;
+
+    ucs_assert(address_count <= UCP_WIREUP_MAX_ADDR_COUNT);
+
+    /* Stage the tested fields, folding the dev/md bitmap tests into an
+     * all-ones/all-zeros mask per address */
+    for (i = 0; i < address_count; ++i) {
+        ae           = &address_list[i];
+        pass_mask[i] = -(uint64_t)(((remote_dev_bitmap >> ae->dev_index) &
+                                    (remote_md_map     >> ae->md_index)) & 1);
+        md_flags[i]  = ae->md_flags;
+        cap_flags[i] = ae->iface_attr.cap_flags;
+        amo_flags[i] = ucp_atomic_flags_pack(&ae->iface_attr.atomic);
+    }
 
-    found               = 0;
-    best_score          = 0.0;
-    best_rsc_index      = 0;
-    best_dst_addr_index = 0;
-    best_score_priority = 0;
-    p                   = tls_info;
-    endp                = tls_info + sizeof(tls_info) - 1;
-    tls_info[0]         = '\0';
+    criteria_amo_flags = ucp_atomic_flags_pack(&criteria->remote_atomic_flags);
+    addr_index_map     = 0;
+    i                  = 0;
+
+#ifdef __AVX2__
+    for (; i + 4 <= address_count; i += 4) {
+        __m256i pred = _mm256_loadu_si256((const __m256i*)&pass_mask[i]);
+
+        pred = _mm256_and_si256(pred,
+                   ucp_wireup_test_all_flags_x4(&md_flags[i],
+                                                criteria->remote_md_flags));
+        pred = _mm256_and_si256(pred,
+                   ucp_wireup_test_all_flags_x4(&cap_flags[i],
+                                                criteria->remote_iface_flags));
+        pred = _mm256_and_si256(pred,
+                   ucp_wireup_test_all_flags_x4(&amo_flags[i],
+                                                criteria_amo_flags));
+
+        addr_index_map |= (uint64_t)(unsigned)
+            _mm256_movemask_pd(_mm256_castsi256_pd(pred)) << i;
+    }
+#endif
+
+    /* Scalar loop - full on non-AVX2 builds, tail otherwise */
+    for (; i < address_count; ++i) {
+        ok = pass_mask[i] &
+             -(uint64_t)(ucs_test_all_flags(md_flags[i],
+                                            criteria->remote_md_flags) &
+                         ucs_test_all_flags(cap_flags[i],
+                                            criteria->remote_iface_flags) &
+                         ucs_test_all_flags(amo_flags[i],
+                                            criteria_amo_flags));
+        addr_index_map |= (ok & 1) << i;
+    }
+
+    return addr_index_map;
+}
+
+/* Emit the trace messages explaining why addresses were filtered out. Runs
+ * only over the rejected addresses, and only when tracing is enabled at
+ * runtime - the message arguments (transport name lookup by checksum, missing
+ * flag formatting) are costly to evaluate, and ucs_trace() by itself discards
+ * the message only after the arguments were computed. */
+static void
+ucp_wireup_trace_unsuitable_addresses(ucp_context_h context,
+                                      const ucp_address_entry_t *address_list,
+                                      unsigned address_count,
+                                      const ucp_wireup_criteria_t *criteria,
+                                      uint64_t remote_md_map,
+                                      uint64_t remote_dev_bitmap,
+                                      uint64_t addr_index_map)
+{
+    const ucp_address_entry_t *ae;
+    unsigned addr_index;
 
-    /* Check which remote addresses satisfy the criteria */
-    addr_index_map = 0;
     for (ae = address_list; ae < address_list + address_count; ++ae) {
         addr_index = ae - address_list;
+        if (addr_index_map & UCS_BIT(addr_index)) {
+            continue;
+        }
+
         if (!(remote_dev_bitmap & UCS_BIT(ae->dev_index))) {
             ucs_trace("addr[%d]: not in use, because on device[%d]",
                       addr_index, ae->dev_index);
@@ -293,11 +552,6 @@ ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list
             continue;
         }
 
-        /* Make sure we are indeed passing all flags required by the criteria in
-         * ucp packed address */
-        ucs_assert(ucs_test_all_flags(UCP_ADDRESS_IFACE_FLAGS,
-                                      criteria->remote_iface_flags));
-
         if (!ucs_test_all_flags(ae->iface_attr.cap_flags, criteria->remote_iface_flags)) {
             ucs_trace("addr[%d] %s: no %s", addr_index,
                       ucp_find_tl_name_by_csum(context, ae->tl_name_csum),
@@ -311,67 +565,82 @@ ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list
         UCP_WIREUP_CHECK_AMO_FLAGS(ae, criteria, context, addr_index, op, 64);
         UCP_WIREUP_CHECK_AMO_FLAGS(ae, criteria, context, addr_index, fop, 32);
         UCP_WIREUP_CHECK_AMO_FLAGS(ae, criteria, context, addr_index, fop, 64);
-
-        addr_index_map |= UCS_BIT(addr_index);
     }
+}
+
+/* Rebuild the per-resource rejection reasons for the selection error
+ * message. Runs only when no transport was found and the caller wants the
+ * error reported, so the selection fast path pays no formatting cost. */
+static void
+ucp_wireup_format_unsuitable_tls(ucp_ep_h ep,
+                                 const ucp_address_entry_t *address_list,
+                                 unsigned address_count,
+                                 const ucp_wireup_criteria_t *criteria,
+                                 uint64_t eligible_rsc_bitmap,
+                                 uint64_t tl_bitmap, uint64_t local_dev_bitmap,
+                                 uint64_t addr_index_map, char *buffer,
+                                 size_t max)
+{
+    ucp_worker_h worker   = ep->worker;
+    ucp_context_h context = worker->context;
+    char *p               = buffer;
+    char *endp            = buffer + max - 1;
+    const ucp_worker_tl_caps_t *caps;
+    uct_tl_resource_desc_t *resource;
+    const ucp_address_entry_t *ae;
+    uct_iface_attr_t *iface_attr;
+    uct_md_attr_t *md_attr;
+    ucp_rsc_index_t rsc_index;
+    int reachable;
+
+    buffer[0] = '\0';
 
     if (!addr_index_map) {
-         snprintf(p, endp - p, "%s  ", ucs_status_string(UCS_ERR_UNSUPPORTED));
-         p += strlen(p);
-         goto out;
+        snprintf(p, endp - p, "%s  ", ucs_status_string(UCS_ERR_UNSUPPORTED));
+        p += strlen(p);
+        goto out;
     }
 
-    /* For each local resource try to find the best remote address to connect to.
-     * Pick the best local resource to satisfy the criteria.
-     * best one has the highest score (from the dedicated score_func) and
-     * has a reachable tl on the remote peer */
     ucs_for_each_bit(rsc_index, context->tl_bitmap) {
-        resource   = &context->tl_rscs[rsc_index].tl_rsc;
-        iface_attr = ucp_worker_iface_get_attr(worker, rsc_index);
-        md_attr    = &context->tl_mds[context->tl_rscs[rsc_index].md_index].attr;
+        caps     = &worker->tl_caps[rsc_index];
+        resource = &context->tl_rscs[rsc_index].tl_rsc;
 
-        if ((context->tl_rscs[rsc_index].flags & UCP_TL_RSC_FLAG_AUX) &&
-            !(criteria->tl_rsc_flags & UCP_TL_RSC_FLAG_AUX)) {
-            continue;
-        }
+        if (!(eligible_rsc_bitmap & UCS_BIT(rsc_index))) {
+            if ((caps->rsc_flags & UCP_TL_RSC_FLAG_AUX) &&
+                !(criteria->tl_rsc_flags & UCP_TL_RSC_FLAG_AUX)) {
+                continue;
+            }
 
-        /* Check that local md and interface satisfy the criteria */
-        if (!ucp_wireup_check_flags(resource, md_attr->cap.flags,
-                                    criteria->local_md_flags, criteria->title,
-                                    ucp_wireup_md_flags, p, endp - p) ||
-            !ucp_wireup_check_flags(resource, iface_attr->cap.flags,
-                                    criteria->local_iface_flags, criteria->title,
-                                    ucp_wireup_iface_flags, p, endp - p) ||
-            !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic32.op_flags,
-                                        criteria->local_atomic_flags.atomic32.op_flags,
-                                        32, 0, criteria->title, p, endp - p) ||
-            !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic64.op_flags,
-                                        criteria->local_atomic_flags.atomic64.op_flags,
-                                        64, 0, criteria->title, p, endp - p) ||
-            !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic32.fop_flags,
-                                        criteria->local_atomic_flags.atomic32.fop_flags,
-                                        32, 1, criteria->title, p, endp - p) ||
-            !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic64.fop_flags,
-                                        criteria->local_atomic_flags.atomic64.fop_flags,
-                                        64, 1, criteria->title, p, endp - p))
-        {
-            p += strlen(p);
-            snprintf(p, endp - p, ", ");
-            p += strlen(p);
+            iface_attr = ucp_worker_iface_get_attr(worker, rsc_index);
+            md_attr    = &context->tl_mds[context->tl_rscs[rsc_index].md_index].attr;
+            if (!ucp_wireup_check_flags(resource, md_attr->cap.flags,
+                                        criteria->local_md_flags, criteria->title,
+                                        ucp_wireup_md_flags, p, endp - p) ||
+                !ucp_wireup_check_flags(resource, iface_attr->cap.flags,
+                                        criteria->local_iface_flags, criteria->title,
+                                        ucp_wireup_iface_flags, p, endp - p) ||
+                !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic32.op_flags,
+                                            criteria->local_atomic_flags.atomic32.op_flags,
+                                            32, 0, criteria->title, p, endp - p) ||
+                !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic64.op_flags,
+                                            criteria->local_atomic_flags.atomic64.op_flags,
+                                            64, 0, criteria->title, p, endp - p) ||
+                !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic32.fop_flags,
+                                            criteria->local_atomic_flags.atomic32.fop_flags,
+                                            32, 1, criteria->title, p, endp - p) ||
+                !ucp_wireup_check_amo_flags(resource, iface_attr->cap.atomic64.fop_flags,
+                                            criteria->local_atomic_flags.atomic64.fop_flags,
+                                            64, 1, criteria->title, p, endp - p))
+            {
+                p += strlen(p);
+                snprintf(p, endp - p, ", ");
+                p += strlen(p);
+            }
             continue;
         }
 
-        /* Check supplied tl & device bitmap */
-        if (!(tl_bitmap & UCS_BIT(rsc_index))) {
-            ucs_trace(UCT_TL_RESOURCE_DESC_FMT " : disabled by tl_bitmap",
-                      UCT_TL_RESOURCE_DESC_ARG(resource));
-            snprintf(p, endp - p, UCT_TL_RESOURCE_DESC_FMT" - disabled for %s, ",
-                     UCT_TL_RESOURCE_DESC_ARG(resource), criteria->title);
-            p += strlen(p);
-            continue;
-        } else if (!(local_dev_bitmap & UCS_BIT(context->tl_rscs[rsc_index].dev_index))) {
-            ucs_trace(UCT_TL_RESOURCE_DESC_FMT " : disabled by device bitmap",
-                      UCT_TL_RESOURCE_DESC_ARG(resource));
+        if (!(tl_bitmap & UCS_BIT(rsc_index)) ||
+            !(local_dev_bitmap & UCS_BIT(caps->dev_index))) {
             snprintf(p, endp - p, UCT_TL_RESOURCE_DESC_FMT" - disabled for %s, ",
                      UCT_TL_RESOURCE_DESC_ARG(resource), criteria->title);
             p += strlen(p);
@@ -379,44 +648,14 @@ ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list
         }
 
         reachable = 0;
-
         for (ae = address_list; ae < address_list + address_count; ++ae) {
-            if (!(addr_index_map & UCS_BIT(ae - address_list)) ||
-                !ucp_wireup_is_reachable(worker, rsc_index, ae))
-            {
-                /* Must be reachable device address, on same transport */
-                continue;
-            }
-
-            reachable = 1;
-
-            score = criteria->calc_score(context, md_attr, iface_attr,
-                                         &ae->iface_attr);
-            ucs_assert(score >= 0.0);
-
-            priority = iface_attr->priority + ae->iface_attr.priority;
-
-            ucs_trace(UCT_TL_RESOURCE_DESC_FMT "->addr[%zd] : %s score %.2f priority %d",
-                      UCT_TL_RESOURCE_DESC_ARG(resource), ae - address_list,
-                      criteria->title, score, priority);
-
-            if (!found ||
-                /* Comparing score with the current best score */
-                (ucp_wireup_score_cmp(score, best_score) > 0) ||
-                /* Comparing priority with the priority of the current best
-                 * transport (if the scores are equal) */
-                ((ucp_wireup_score_cmp(score, best_score) == 0) &&
-                 (priority > best_score_priority))) {
-                best_rsc_index      = rsc_index;
-                best_dst_addr_index = ae - address_list;
-                best_score          = score;
-                best_score_priority = priority;
-                found               = 1;
+            if ((addr_index_map & UCS_BIT(ae - address_list)) &&
+                ucp_wireup_is_reachable(worker, rsc_index, ae)) {
+                reachable = 1;
+                break;
             }
         }
 
-        /* If a local resource cannot reach any of the remote addresses,
-         * generate debug message. */
         if (!reachable) {
             snprintf(p, endp - p, UCT_TL_RESOURCE_DESC_FMT" - %s, ",
                      UCT_TL_RESOURCE_DESC_ARG(resource),
@@ -426,16 +665,231 @@ ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list
     }
 
 out:
-    if (p >= tls_info + 2) {
+    if (p >= buffer + 2) {
         *(p - 2) = '\0'; /* trim last "," */
     }
+}
+
+/* Return the bitmap of remote addresses whose md/iface/atomic flags satisfy
+ * the criteria, memoized in the selection context. Each lane class evaluates
+ * its flag masks over the same address list - often several times, since the
+ * memaccess loops re-select while only the md/dev restriction maps change -
+ * so the flag filtering runs once per distinct criteria and repeats are a
+ * cache probe. The md/dev restrictions are applied separately by
+ * ucp_wireup_restrict_addr_map(). */
+static uint64_t
+ucp_wireup_criteria_addr_map(ucp_wireup_select_ctx_t *select_ctx,
+                             const ucp_wireup_criteria_t *criteria)
+{
+    uint64_t amo_flags = ucp_atomic_flags_pack(&criteria->remote_atomic_flags);
+    uint64_t addr_map;
+    unsigned i;
+
+    for (i = 0; i < ucs_array_size(select_ctx->addr_filter_cache); ++i) {
+        if (select_ctx->addr_filter_cache[i].valid &&
+            (select_ctx->addr_filter_cache[i].remote_md_flags ==
+             criteria->remote_md_flags) &&
+            (select_ctx->addr_filter_cache[i].remote_iface_flags ==
+             criteria->remote_iface_flags) &&
+            (select_ctx->addr_filter_cache[i].remote_amo_flags == amo_flags)) {
+            return select_ctx->addr_filter_cache[i].addr_map;
+        }
+    }
+
+    addr_map = ucp_wireup_filter_addresses(select_ctx->address_list,
+                                           select_ctx->address_count,
+                                           criteria, -1, -1);
+
+    i = select_ctx->addr_filter_cache_lru;
+    select_ctx->addr_filter_cache[i].remote_md_flags    =
+        criteria->remote_md_flags;
+    select_ctx->addr_filter_cache[i].remote_iface_flags =
+        criteria->remote_iface_flags;
+    select_ctx->addr_filter_cache[i].remote_amo_flags   = amo_flags;
+    select_ctx->addr_filter_cache[i].addr_map           = addr_map;
+    select_ctx->addr_filter_cache[i].valid              = 1;
+    select_ctx->addr_filter_cache_lru =
+        (i + 1) % ucs_array_size(select_ctx->addr_filter_cache);
+
+    return addr_map;
+}
+
+/* Apply the remote md/dev restriction maps to a flag-filtered address
+ * bitmap. The common case of no restriction is a single compare. */
+static uint64_t
+ucp_wireup_restrict_addr_map(const ucp_wireup_select_ctx_t *select_ctx,
+                             uint64_t addr_map, uint64_t remote_md_map,
+                             uint64_t remote_dev_bitmap)
+{
+    unsigned addr_index;
+
+    if ((remote_md_map & remote_dev_bitmap) == (uint64_t)-1) {
+        return addr_map;
+    }
+
+    ucs_for_each_bit(addr_index, addr_map) {
+        if (!((remote_md_map >> select_ctx->addr_md_index[addr_index]) &
+              (remote_dev_bitmap >> select_ctx->addr_dev_index[addr_index]) &
+              1)) {
+            addr_map &= ~UCS_BIT(addr_index);
+        }
+    }
+
+    return addr_map;
+}
+
+/**
+ * Select a local and remote transport, with the bitmap of locally eligible
+ * resources (see @ref ucp_wireup_eligible_rsc_bitmap) supplied by the caller.
+ */
+static UCS_F_NOINLINE ucs_status_t
+ucp_wireup_select_transport_eligible(ucp_ep_h ep,
+                                     const ucp_address_entry_t *address_list,
+                                     unsigned address_count,
+                                     const ucp_wireup_criteria_t *criteria,
+                                     uint64_t eligible_rsc_bitmap,
+                                     ucp_wireup_select_ctx_t *select_ctx,
+                                     uint64_t tl_bitmap, uint64_t remote_md_map,
+                                     uint64_t local_dev_bitmap,
+                                     uint64_t remote_dev_bitmap, int show_error,
+                                     ucp_wireup_select_info_t *select_info)
+{
+    ucp_worker_h worker   = ep->worker;
+    ucp_context_h context = worker->context;
+    uct_tl_resource_desc_t *resource;
+    const ucp_worker_tl_caps_t *caps;
+    const ucp_address_entry_t *ae;
+    ucp_rsc_index_t rsc_index, best_rsc_index;
+    double score, best_score;
+    char tls_info[256];
+    uct_iface_attr_t *iface_attr;
+    uct_md_attr_t *md_attr;
+    double scores[UCP_WIREUP_MAX_ADDR_COUNT];
+    uint64_t addr_index_map, reachable_map;
+    unsigned addr_index;
+    unsigned best_dst_addr_index;
+    int found;
+    int cmp, take;
+    uint8_t priority, best_score_priority;
+
+    found               = 0;
+    best_score          = 0.0;
+    best_rsc_index      = 0;
+    best_dst_addr_index = 0;
+    best_score_priority = 0;
+
+    /* Make sure we are indeed passing all flags required by the criteria in
+     * ucp packed address */
+    ucs_assert(ucs_test_all_flags(UCP_ADDRESS_IFACE_FLAGS,
+                                  criteria->remote_iface_flags));
+
+    /* Check which remote addresses satisfy the criteria */
+    if (select_ctx != NULL) {
+        addr_index_map = ucp_wireup_restrict_addr_map(
+                             select_ctx,
+                             ucp_wireup_criteria_addr_map(select_ctx, criteria),
+                             remote_md_map, remote_dev_bitmap);
+    } else {
+        addr_index_map = ucp_wireup_filter_addresses(address_list,
+                                                     address_count, criteria,
+                                                     remote_md_map,
+                                                     remote_dev_bitmap);
+    }
+    if (ucs_unlikely((ucs_popcount(addr_index_map) != address_count) &&
+                     ucs_log_is_enabled(UCS_LOG_LEVEL_TRACE))) {
+        ucp_wireup_trace_unsuitable_addresses(context, address_list,
+                                              address_count, criteria,
+                                              remote_md_map, remote_dev_bitmap,
+                                              addr_index_map);
+    }
+
+    if (!addr_index_map) {
+        goto out;
+    }
+
+    /* For each local resource try to find the best remote address to connect to.
+     * Pick the best local resource to satisfy the criteria.
+     * best one has the highest score (from the dedicated score_func) and
+     * has a reachable tl on the remote peer */
+    ucs_for_each_bit(rsc_index, context->tl_bitmap) {
+        caps = &worker->tl_caps[rsc_index];
+
+        /* Check that local md and interface satisfy the criteria, and the
+         * supplied tl & device bitmaps. Rejection reasons are reconstructed
+         * by ucp_wireup_format_unsuitable_tls() only if selection fails. */
+        if (!(eligible_rsc_bitmap & UCS_BIT(rsc_index)) ||
+            !(tl_bitmap & UCS_BIT(rsc_index)) ||
+            !(local_dev_bitmap & UCS_BIT(caps->dev_index))) {
+            continue;
+        }
+
+        resource   = &context->tl_rscs[rsc_index].tl_rsc;
+        iface_attr = ucp_worker_iface_get_attr(worker, rsc_index);
+        md_attr    = &context->tl_mds[context->tl_rscs[rsc_index].md_index].attr;
+
+        /* Must be reachable device address, on same transport */
+        if (select_ctx != NULL) {
+            reachable_map = addr_index_map &
+                            select_ctx->rsc_reachable_addrs[rsc_index];
+        } else {
+            reachable_map = 0;
+            ucs_for_each_bit(addr_index, addr_index_map) {
+                if (ucp_wireup_is_reachable(worker, rsc_index,
+                                            &address_list[addr_index])) {
+                    reachable_map |= UCS_BIT(addr_index);
+                }
+            }
+        }
+
+        if (!reachable_map) {
+            continue;
+        }
+
+        /* Evaluate all candidate addresses for this resource with a single
+         * dispatch of the batched score function */
+        criteria->calc_score_batch(context, md_attr, iface_attr, address_list,
+                                   reachable_map, scores);
+
+        ucs_for_each_bit(addr_index, reachable_map) {
+            ae    = &address_list[addr_index];
+            score = scores[addr_index];
+            ucs_assert(score >= 0.0);
+
+            priority = iface_attr->priority + ae->iface_attr.priority;
+
+            ucs_trace(UCT_TL_RESOURCE_DESC_FMT "->addr[%u] : %s score %.2f priority %d",
+                      UCT_TL_RESOURCE_DESC_ARG(resource), addr_index,
+                      criteria->title, score, priority);
+
+            /* Branchless argmax update: scores of competing transports tend
+             * to cluster, which makes a conditional block mispredict; with
+             * every best_* field a ternary of the same predicate the compiler
+             * emits conditional moves instead. Priority breaks ties between
+             * equal scores. */
+            cmp  = ucp_wireup_score_cmp(score, best_score);
+            take = !found | (cmp > 0) |
+                   ((cmp == 0) & (priority > best_score_priority));
+
+            best_rsc_index      = take ? rsc_index  : best_rsc_index;
+            best_dst_addr_index = take ? addr_index : best_dst_addr_index;
+            best_score          = take ? score      : best_score;
+            best_score_priority = take ? priority   : best_score_priority;
+            found              |= take;
+        }
+    }
 
+out:
     select_info->rsc_index  = best_rsc_index;
     select_info->addr_index = best_dst_addr_index;
     select_info->score      = best_score;
 
     if (!found) {
         if (show_error) {
+            ucp_wireup_format_unsuitable_tls(ep, address_list, address_count,
+                                             criteria, eligible_rsc_bitmap,
+                                             tl_bitmap, local_dev_bitmap,
+                                             addr_index_map, tls_info,
+                                             sizeof(tls_info));
             ucs_error("no %s transport to %s: %s", criteria->title,
                       ucp_ep_peer_name(ep), tls_info);
         }
@@ -453,9 +907,24 @@ out:
     return UCS_OK;
 }
 
-static inline double ucp_wireup_tl_iface_latency(ucp_context_h context,
-                                                 const uct_iface_attr_t *iface_attr,
-                                                 const ucp_address_iface_attr_t *remote_iface_attr)
+static ucs_status_t
+ucp_wireup_select_transport(ucp_ep_h ep, const ucp_address_entry_t *address_list,
+                            unsigned address_count, const ucp_wireup_criteria_t *criteria,
+                            uint64_t tl_bitmap, uint64_t remote_md_map,
+                            uint64_t local_dev_bitmap, uint64_t remote_dev_bitmap,
+                            int show_error, ucp_wireup_select_info_t *select_info)
+{
+    return ucp_wireup_select_transport_eligible(
+               ep, address_list, address_count, criteria,
+               ucp_wireup_eligible_rsc_bitmap(ep->worker, criteria), NULL,
+               tl_bitmap, remote_md_map, local_dev_bitmap, remote_dev_bitmap,
+               show_error, select_info);
+}
+
+static UCS_F_ALWAYS_INLINE double
+ucp_wireup_tl_iface_latency(ucp_context_h context,
+                            const uct_iface_attr_t *iface_attr,
+                            const ucp_address_iface_attr_t *remote_iface_attr)
 {
     return ucs_max(iface_attr->latency.overhead, remote_iface_attr->lat_ovh) +
            (iface_attr->latency.growth * context->config.est_num_eps);
@@ -467,20 +936,30 @@ ucp_wireup_add_lane_desc(ucp_wireup_select_ctx_t *select_ctx,
                          ucp_rsc_index_t dst_md_index,
                          uint32_t usage, int is_proxy)
 {
+    ucp_ep_config_key_t *key = select_ctx->key;
     ucp_wireup_lane_desc_t *lane_desc;
     ucp_lane_index_t lane, proxy_lane;
     int proxy_changed;
+    uint16_t dedup_key;
 
     /* Add a new lane, but try to reuse already added lanes which are selected
-     * on the same transport resources.
+     * on the same transport resources. The scan compares packed
+     * (rsc_index, addr_index) keys, and is skipped entirely when the used
+     * resource/address bitmaps show that no existing lane can match - the
+     * common case when each selection picks a distinct resource.
      */
+    dedup_key     = ((uint16_t)select_info->rsc_index << 8) |
+                    select_info->addr_index;
     proxy_changed = 0;
-    for (lane_desc = select_ctx->lane_descs;
-         lane_desc < select_ctx->lane_descs + select_ctx->num_lanes; ++lane_desc) {
-        if ((lane_desc->rsc_index == select_info->rsc_index) &&
-            (lane_desc->addr_index == select_info->addr_index))
-        {
-            lane = lane_desc - select_ctx->lane_descs;
+
+    if ((select_ctx->used_rsc_bitmap & UCS_BIT(select_info->rsc_index)) &&
+        (select_ctx->used_addr_bitmap & UCS_BIT(select_info->addr_index))) {
+        for (lane = 0; lane < select_ctx->num_lanes; ++lane) {
+            if (select_ctx->lane_keys[lane] != dedup_key) {
+                continue;
+            }
+
+            lane_desc = &select_ctx->lane_descs[lane];
             ucs_assertv_always(dst_md_index == lane_desc->dst_md_index,
                                "lane[%d].dst_md_index=%d, dst_md_index=%d",
                                lane, lane_desc->dst_md_index, dst_md_index);
@@ -497,8 +976,9 @@ ucp_wireup_add_lane_desc(ucp_wireup_select_ctx_t *select_ctx,
                  * could use the new lane. It also means we should be able to
                  * add our new lane.
                  */
-                lane_desc->proxy_lane = select_ctx->num_lanes;
-                proxy_changed = 1;
+                lane_desc->proxy_lane        = select_ctx->num_lanes;
+                key->lanes[lane].proxy_lane  = select_ctx->num_lanes;
+                proxy_changed                = 1;
             } else if (!is_proxy && (lane_desc->proxy_lane == UCP_NULL_LANE)) {
                 /* Found non-proxy lane with same resource - don't add */
                 ucs_assert_always(!proxy_changed);
@@ -513,12 +993,33 @@ ucp_wireup_add_lane_desc(ucp_wireup_select_ctx_t *select_ctx,
 
 out_add_lane:
     lane_desc = &select_ctx->lane_descs[select_ctx->num_lanes];
+    select_ctx->lane_keys[select_ctx->num_lanes] = dedup_key;
+    select_ctx->used_rsc_bitmap  |= UCS_BIT(select_info->rsc_index);
+    select_ctx->used_addr_bitmap |= UCS_BIT(select_info->addr_index);
+
+    /* Write the immutable lane fields of the EP configuration key in place,
+     * so constructing the key later does not re-copy them from the
+     * descriptor array */
+    key->lanes[select_ctx->num_lanes].rsc_index    = select_info->rsc_index;
+    key->lanes[select_ctx->num_lanes].proxy_lane   = proxy_lane;
+    key->lanes[select_ctx->num_lanes].dst_md_index = dst_md_index;
+    select_ctx->addr_indices[select_ctx->num_lanes] = select_info->addr_index;
     ++select_ctx->num_lanes;
 
     lane_desc->rsc_index    = select_info->rsc_index;
     lane_desc->addr_index   = select_info->addr_index;
     lane_desc->proxy_lane   = proxy_lane;
     lane_desc->dst_md_index = dst_md_index;
+    /* Record whether this lane could carry wireup messages, so selecting the
+     * wireup message lane later is a plain bit test per lane */
+    lane_desc->aux_caps     =
+        (ucs_test_all_flags(ucp_worker_iface_get_attr(select_ctx->worker,
+                                                      select_info->rsc_index)->cap.flags,
+                            select_ctx->aux_local_iface_flags) ?
+         UCP_WIREUP_AUX_CAP_LOCAL : 0) |
+        (ucs_test_all_flags(select_ctx->addr_cap_flags[select_info->addr_index],
+                            select_ctx->aux_remote_iface_flags) ?
+         UCP_WIREUP_AUX_CAP_REMOTE : 0);
     lane_desc->usage        = usage;
     lane_desc->am_bw_score  = 0.0;
     lane_desc->rma_score    = 0.0;
@@ -540,41 +1041,91 @@ out_update_score:
     }
 }
 
-#define UCP_WIREUP_COMPARE_SCORE(_elem1, _elem2, _arg, _token) \
-    ({ \
-        const ucp_lane_index_t *lane1 = (_elem1); \
-        const ucp_lane_index_t *lane2 = (_elem2); \
-        const ucp_wireup_lane_desc_t *lanes = (_arg); \
-        double score1, score2; \
-        \
-        score1 = (*lane1 == UCP_NULL_LANE) ? 0.0 : lanes[*lane1]._token##_score; \
-        score2 = (*lane2 == UCP_NULL_LANE) ? 0.0 : lanes[*lane2]._token##_score; \
-        /* sort from highest score to lowest */ \
-        (score1 < score2) ? 1 : ((score1 > score2) ? -1 : 0); \
-    })
-
-static int ucp_wireup_compare_lane_am_bw_score(const void *elem1, const void *elem2,
-                                               void *arg)
+static UCS_F_ALWAYS_INLINE double
+ucp_wireup_lane_score(const ucp_wireup_lane_desc_t *lane_descs,
+                      ucp_lane_index_t lane, size_t score_offset)
 {
-    return UCP_WIREUP_COMPARE_SCORE(elem1, elem2, arg, am_bw);
+    return (lane == UCP_NULL_LANE) ? 0.0 :
+           *(const double*)UCS_PTR_BYTE_OFFSET(&lane_descs[lane], score_offset);
 }
 
-static int ucp_wireup_compare_lane_rma_score(const void *elem1, const void *elem2,
-                                             void *arg)
+/* Descending compare-exchange of entries _i and _j of the key/lane arrays.
+ * The branchless selects compile to conditional moves, so the network below
+ * is straight-line code with no data-dependent branches. */
+static UCS_F_ALWAYS_INLINE void
+ucp_wireup_sort_cswap(uint64_t *keys, ucp_lane_index_t *lanes,
+                      unsigned i, unsigned j)
 {
-    return UCP_WIREUP_COMPARE_SCORE(elem1, elem2, arg, rma);
+    int swap              = keys[i] < keys[j];
+    uint64_t key_hi       = swap ? keys[j]  : keys[i];
+    uint64_t key_lo       = swap ? keys[i]  : keys[j];
+    ucp_lane_index_t hi   = swap ? lanes[j] : lanes[i];
+    ucp_lane_index_t lo   = swap ? lanes[i] : lanes[j];
+
+    keys[i]  = key_hi;
+    keys[j]  = key_lo;
+    lanes[i] = hi;
+    lanes[j] = lo;
 }
 
-static int ucp_wireup_compare_lane_rma_bw_score(const void *elem1, const void *elem2,
-                                             void *arg)
+/* Sort a lane index array from highest score to lowest, taking the score
+ * from the lane descriptor field at score_offset. The scores are gathered
+ * once and packed into integer sort keys: the scores are non-negative, so
+ * their IEEE-754 bit patterns order the same way as the values, and the
+ * sort moves integers instead of re-reading the descriptors. The array
+ * shape is fixed at UCP_MAX_LANES entries, so the sort is a 12-comparator
+ * sorting network of unconditional compare-exchanges instead of a
+ * data-dependent loop. */
+static void ucp_wireup_sort_lanes(ucp_lane_index_t *lanes, unsigned count,
+                                  const ucp_wireup_lane_desc_t *lane_descs,
+                                  size_t score_offset)
 {
-    return UCP_WIREUP_COMPARE_SCORE(elem1, elem2, arg, rma_bw);
-}
+    uint64_t keys[UCP_MAX_LANES];
+    ucp_lane_index_t net_lanes[UCP_MAX_LANES];
+    union {
+        double   score;
+        uint64_t bits;
+    } key;
+    unsigned i;
+
+    /* The network below is the optimal sorting network for 6 inputs; the
+     * position tiebreak needs 3 low mantissa bits */
+    UCS_STATIC_ASSERT(UCP_MAX_LANES == 6);
+    ucs_assert(count <= UCP_MAX_LANES);
+
+    for (i = 0; i < UCP_MAX_LANES; ++i) {
+        if (i < count) {
+            key.score    = ucp_wireup_lane_score(lane_descs, lanes[i],
+                                                 score_offset);
+            net_lanes[i] = lanes[i];
+        } else {
+            key.score    = 0.0;
+            net_lanes[i] = UCP_NULL_LANE;
+        }
 
-static int ucp_wireup_compare_lane_amo_score(const void *elem1, const void *elem2,
-                                             void *arg)
-{
-    return UCP_WIREUP_COMPARE_SCORE(elem1, elem2, arg, amo);
+        /* Repurpose the low mantissa bits as a position tiebreak, keeping
+         * equal-score lanes in selection order. The dropped bits are many
+         * orders of magnitude below the relative epsilon which
+         * ucp_wireup_score_cmp() already treats as a tie. */
+        keys[i] = (key.bits & ~UCS_MASK(3)) | (UCP_MAX_LANES - 1 - i);
+    }
+
+    ucp_wireup_sort_cswap(keys, net_lanes, 0, 5);
+    ucp_wireup_sort_cswap(keys, net_lanes, 1, 3);
+    ucp_wireup_sort_cswap(keys, net_lanes, 2, 4);
+    ucp_wireup_sort_cswap(keys, net_lanes, 1, 2);
+    ucp_wireup_sort_cswap(keys, net_lanes, 3, 4);
+    ucp_wireup_sort_cswap(keys, net_lanes, 0, 3);
+    ucp_wireup_sort_cswap(keys, net_lanes, 2, 5);
+    ucp_wireup_sort_cswap(keys, net_lanes, 0, 1);
+    ucp_wireup_sort_cswap(keys, net_lanes, 2, 3);
+    ucp_wireup_sort_cswap(keys, net_lanes, 4, 5);
+    ucp_wireup_sort_cswap(keys, net_lanes, 1, 2);
+    ucp_wireup_sort_cswap(keys, net_lanes, 3, 4);
+
+    for (i = 0; i < count; ++i) {
+        lanes[i] = net_lanes[i];
+    }
 }
 
 static uint64_t ucp_wireup_unset_tl_by_md(ucp_ep_h ep, uint64_t tl_bitmap,
@@ -582,15 +1133,8 @@ static uint64_t ucp_wireup_unset_tl_by_md(ucp_ep_h ep, uint64_t tl_bitmap,
 {
     ucp_context_h context    = ep->worker->context;
     ucp_rsc_index_t md_index = context->tl_rscs[rsc_index].md_index;
-    ucp_rsc_index_t i;
-
-    ucs_for_each_bit(i, context->tl_bitmap) {
-        if (context->tl_rscs[i].md_index == md_index) {
-            tl_bitmap &= ~UCS_BIT(i);
-        }
-    }
 
-    return tl_bitmap;
+    return tl_bitmap & ~context->md_rsc_bitmap[md_index];
 }
 
 static UCS_F_NOINLINE ucs_status_t
@@ -604,25 +1148,30 @@ ucp_wireup_add_memaccess_lanes(ucp_wireup_select_ctx_t *select_ctx,
     int show_error                       = !select_ctx->allow_am;
     ucp_rsc_index_t dst_md_index;
     double reg_score;
+    uint64_t eligible_rsc_bitmap;
     uint64_t remote_md_map;
     ucs_status_t status;
-    char title[64];
 
     remote_md_map = -1;
 
+    /* The local criteria are the same for all selections below, so the
+     * eligibility bitmap is computed once */
+    eligible_rsc_bitmap = ucp_wireup_eligible_rsc_bitmap(ep->worker, criteria);
+
     /* Select best transport which can reach registered memory */
-    snprintf(title, sizeof(title), criteria->title, "registered");
-    mem_criteria.title           = title;
     mem_criteria.remote_md_flags = UCT_MD_FLAG_REG | criteria->remote_md_flags;
-    status = ucp_wireup_select_transport(ep, select_ctx->address_list,
-                                         select_ctx->address_count,
-                                         &mem_criteria, tl_bitmap, remote_md_map,
-                                         -1, -1, show_error, &select_info);
+    status = ucp_wireup_select_transport_eligible(ep, select_ctx->address_list,
+                                                  select_ctx->address_count,
+                                                  &mem_criteria,
+                                                  eligible_rsc_bitmap,
+                                                  select_ctx, tl_bitmap,
+                                                  remote_md_map, -1, -1,
+                                                  show_error, &select_info);
     if (status != UCS_OK) {
         goto out;
     }
 
-    dst_md_index = select_ctx->address_list[select_info.addr_index].md_index;
+    dst_md_index = select_ctx->addr_md_index[select_info.addr_index];
     reg_score    = select_info.score;
 
     /* Add to the list of lanes and remove all occurrences of the remote md
@@ -637,16 +1186,19 @@ ucp_wireup_add_memaccess_lanes(ucp_wireup_select_ctx_t *select_ctx,
      * block can be potentially allocated using one of them, and we might get
      * better performance than the transports which support only registered
      * remote memory. */
-    snprintf(title, sizeof(title), criteria->title, "allocated");
-    mem_criteria.title           = title;
+    mem_criteria.title           = criteria->alloc_title;
     mem_criteria.remote_md_flags = UCT_MD_FLAG_ALLOC |
                                    criteria->remote_md_flags;
 
     while (select_ctx->address_count > 0) {
-        status = ucp_wireup_select_transport(ep, select_ctx->address_list,
-                                             select_ctx->address_count,
-                                             &mem_criteria, tl_bitmap, remote_md_map,
-                                             -1, -1, 0, &select_info);
+        status = ucp_wireup_select_transport_eligible(ep,
+                                                      select_ctx->address_list,
+                                                      select_ctx->address_count,
+                                                      &mem_criteria,
+                                                      eligible_rsc_bitmap,
+                                                      select_ctx, tl_bitmap,
+                                                      remote_md_map, -1, -1, 0,
+                                                      &select_info);
         /* Break if: */
         /* - transport selection wasn't OK */
         if ((status != UCS_OK) ||
@@ -657,7 +1209,7 @@ ucp_wireup_add_memaccess_lanes(ucp_wireup_select_ctx_t *select_ctx,
         }
 
         /* Add lane description and remove all occurrences of the remote md. */
-        dst_md_index = select_ctx->address_list[select_info.addr_index].md_index;
+        dst_md_index = select_ctx->addr_md_index[select_info.addr_index];
         ucp_wireup_add_lane_desc(select_ctx, &select_info, dst_md_index, usage, 0);
         remote_md_map &= ~UCS_BIT(dst_md_index);
         tl_bitmap = ucp_wireup_unset_tl_by_md(ep, tl_bitmap,
@@ -676,11 +1228,6 @@ out:
     return status;
 }
 
-static uint64_t ucp_ep_get_context_features(ucp_ep_h ep)
-{
-    return ep->worker->context->config.features;
-}
-
 static double ucp_wireup_rma_score_func(ucp_context_h context,
                                         const uct_md_attr_t *md_attr,
                                         const uct_iface_attr_t *iface_attr,
@@ -690,9 +1237,12 @@ static double ucp_wireup_rma_score_func(ucp_context_h context,
     return 1e-3 / (ucp_wireup_tl_iface_latency(context, iface_attr, remote_iface_attr) +
                    iface_attr->overhead +
                    (4096.0 / ucs_min(ucp_tl_iface_bandwidth(context, &iface_attr->bandwidth),
-                                     ucp_tl_iface_bandwidth(context, &remote_iface_attr->bandwidth))));
+                                     remote_iface_attr->eff_bandwidth)));
 }
 
+UCP_WIREUP_SCORE_BATCH_FUNC(ucp_wireup_rma_score_batch,
+                            ucp_wireup_rma_score_func)
+
 static int ucp_wireup_ep_params_is_err_mode_peer(const ucp_ep_params_t *params)
 {
     return (params->field_mask & UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE) &&
@@ -707,32 +1257,29 @@ static void ucp_wireup_fill_ep_params_criteria(ucp_wireup_criteria_t *criteria,
     }
 }
 
+/* The invariant parts of each selection criteria are kept in static const
+ * templates, so every add_*_lanes call starts from a single struct copy and
+ * patches only the fields which depend on the endpoint, instead of zeroing
+ * and re-assembling the whole aggregate on the stack. */
+static const ucp_wireup_criteria_t ucp_wireup_aux_criteria_tmpl = {
+    .title              = "auxiliary",
+    .local_iface_flags  = UCT_IFACE_FLAG_CONNECT_TO_IFACE |
+                          UCT_IFACE_FLAG_AM_BCOPY |
+                          UCT_IFACE_FLAG_PENDING,
+    .remote_iface_flags = UCT_IFACE_FLAG_CONNECT_TO_IFACE |
+                          UCT_IFACE_FLAG_AM_BCOPY |
+                          UCT_IFACE_FLAG_CB_ASYNC,
+    .calc_score_batch   = ucp_wireup_aux_score_batch,
+    .tl_rsc_flags       = UCP_TL_RSC_FLAG_AUX /* Can use aux transports */
+};
+
 static void ucp_wireup_fill_aux_criteria(ucp_wireup_criteria_t *criteria,
                                          const ucp_ep_params_t *params)
 {
-    criteria->title              = "auxiliary";
-    criteria->local_md_flags     = 0;
-    criteria->remote_md_flags    = 0;
-    criteria->local_iface_flags  = UCT_IFACE_FLAG_CONNECT_TO_IFACE |
-                                   UCT_IFACE_FLAG_AM_BCOPY |
-                                   UCT_IFACE_FLAG_PENDING;
-    criteria->remote_iface_flags = UCT_IFACE_FLAG_CONNECT_TO_IFACE |
-                                   UCT_IFACE_FLAG_AM_BCOPY |
-                                   UCT_IFACE_FLAG_CB_ASYNC;
-    criteria->calc_score         = ucp_wireup_aux_score_func;
-    criteria->tl_rsc_flags       = UCP_TL_RSC_FLAG_AUX; /* Can use aux transports */
-
+    *criteria = ucp_wireup_aux_criteria_tmpl;
     ucp_wireup_fill_ep_params_criteria(criteria, params);
 }
 
-static void ucp_wireup_clean_amo_criteria(ucp_wireup_criteria_t *criteria)
-{
-    memset(&criteria->remote_atomic_flags, 0,
-           sizeof(criteria->remote_atomic_flags));
-    memset(&criteria->local_atomic_flags, 0,
-           sizeof(criteria->local_atomic_flags));
-}
-
 static int ucp_wireup_allow_am_emulation_layer(const ucp_ep_params_t *params,
                                                unsigned ep_init_flags)
 {
@@ -742,29 +1289,34 @@ static int ucp_wireup_allow_am_emulation_layer(const ucp_ep_params_t *params,
            !ucp_wireup_ep_params_is_err_mode_peer(params);
 }
 
+static const ucp_wireup_criteria_t ucp_wireup_rma_criteria_tmpl = {
+    .title              = "remote registered memory access",
+    .alloc_title        = "remote allocated memory access",
+    .remote_iface_flags = UCT_IFACE_FLAG_PUT_SHORT |
+                          UCT_IFACE_FLAG_PUT_BCOPY |
+                          UCT_IFACE_FLAG_GET_BCOPY,
+    .local_iface_flags  = UCT_IFACE_FLAG_PUT_SHORT |
+                          UCT_IFACE_FLAG_PUT_BCOPY |
+                          UCT_IFACE_FLAG_GET_BCOPY |
+                          UCT_IFACE_FLAG_PENDING,
+    .calc_score_batch   = ucp_wireup_rma_score_batch
+};
+
+static const ucp_wireup_criteria_t ucp_wireup_rma_mem_type_criteria_tmpl = {
+    .title              = "copy across memory types",
+    .alloc_title        = "copy across memory types",
+    .remote_iface_flags = UCT_IFACE_FLAG_PUT_SHORT,
+    .local_iface_flags  = UCT_IFACE_FLAG_PUT_SHORT,
+    .calc_score_batch   = ucp_wireup_rma_score_batch
+};
+
 static ucs_status_t ucp_wireup_add_rma_lanes(ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_wireup_criteria_t criteria = {0};
-
-    if (!(ucp_ep_get_context_features(select_ctx->ep) & UCP_FEATURE_RMA) &&
-        !(select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE)) {
-        return UCS_OK;
-    }
+    ucp_wireup_criteria_t criteria;
 
-    if (select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) {
-        criteria.title              = "copy across memory types";
-        criteria.remote_iface_flags = UCT_IFACE_FLAG_PUT_SHORT;
-        criteria.local_iface_flags  = criteria.remote_iface_flags;
-    } else {
-        criteria.title              = "remote %s memory access";
-        criteria.remote_iface_flags = UCT_IFACE_FLAG_PUT_SHORT |
-                                      UCT_IFACE_FLAG_PUT_BCOPY |
-                                      UCT_IFACE_FLAG_GET_BCOPY;
-        criteria.local_iface_flags  = criteria.remote_iface_flags |
-                                      UCT_IFACE_FLAG_PENDING;
-    }
-    criteria.calc_score             = ucp_wireup_rma_score_func;
-    criteria.tl_rsc_flags           = 0;
+    criteria = (select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) ?
+               ucp_wireup_rma_mem_type_criteria_tmpl :
+               ucp_wireup_rma_criteria_tmpl;
     ucp_wireup_fill_ep_params_criteria(&criteria, select_ctx->params);
 
     return ucp_wireup_add_memaccess_lanes(select_ctx, &criteria,
@@ -781,39 +1333,34 @@ double ucp_wireup_amo_score_func(ucp_context_h context,
                    iface_attr->overhead);
 }
 
+UCP_WIREUP_SCORE_BATCH_FUNC(ucp_wireup_amo_score_batch,
+                            ucp_wireup_amo_score_func)
+
+static const ucp_wireup_criteria_t ucp_wireup_amo_criteria_tmpl = {
+    .title             = "atomic operations on registered memory",
+    .alloc_title       = "atomic operations on allocated memory",
+    .local_iface_flags = UCT_IFACE_FLAG_PENDING,
+    .calc_score_batch  = ucp_wireup_amo_score_batch
+};
+
 static ucs_status_t ucp_wireup_add_amo_lanes(ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_worker_h worker            = select_ctx->ep->worker;
-    ucp_context_h context          = worker->context;
-    ucp_wireup_criteria_t criteria = {0};
-    ucp_rsc_index_t rsc_index;
+    ucp_worker_h worker   = select_ctx->worker;
+    ucp_context_h context = select_ctx->context;
+    ucp_wireup_criteria_t criteria;
     uint64_t tl_bitmap;
 
-    if (!ucs_test_flags(context->config.features,
-                        UCP_FEATURE_AMO32, UCP_FEATURE_AMO64) ||
-        (select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE)) {
-        return UCS_OK;
-    }
-
+    criteria = ucp_wireup_amo_criteria_tmpl;
     ucp_context_uct_atomic_iface_flags(context, &criteria.remote_atomic_flags);
-
-    criteria.title              = "atomic operations on %s memory";
-    criteria.local_iface_flags  = criteria.remote_iface_flags |
-                                  UCT_IFACE_FLAG_PENDING;
     criteria.local_atomic_flags = criteria.remote_atomic_flags;
-    criteria.calc_score         = ucp_wireup_amo_score_func;
     ucp_wireup_fill_ep_params_criteria(&criteria, select_ctx->params);
 
     /* We can use only non-p2p resources or resources which are explicitly
      * selected for atomics. Otherwise, the remote peer would not be able to
      * connect back on p2p transport.
      */
-    tl_bitmap = worker->atomic_tls;
-    for (rsc_index = 0; rsc_index < context->num_tls; ++rsc_index) {
-        if (!ucp_worker_is_tl_p2p(worker, rsc_index)) {
-            tl_bitmap |= UCS_BIT(rsc_index);
-        }
-    }
+    tl_bitmap = worker->atomic_tls |
+                (context->tl_bitmap & ~worker->p2p_rsc_bitmap);
 
     return ucp_wireup_add_memaccess_lanes(select_ctx, &criteria,
                                           tl_bitmap, UCP_WIREUP_LANE_USAGE_AMO);
@@ -829,6 +1376,9 @@ static double ucp_wireup_am_score_func(ucp_context_h context,
                    iface_attr->overhead + remote_iface_attr->overhead);
 }
 
+UCP_WIREUP_SCORE_BATCH_FUNC(ucp_wireup_am_score_batch,
+                            ucp_wireup_am_score_func)
+
 static double ucp_wireup_rma_bw_score_func(ucp_context_h context,
                                            const uct_md_attr_t *md_attr,
                                            const uct_iface_attr_t *iface_attr,
@@ -839,16 +1389,23 @@ static double ucp_wireup_rma_bw_score_func(ucp_context_h context,
      * how long it would take to transfer it with a certain transport. */
     return 1 / ((UCP_WIREUP_RMA_BW_TEST_MSG_SIZE /
                 ucs_min(ucp_tl_iface_bandwidth(context, &iface_attr->bandwidth),
-                        ucp_tl_iface_bandwidth(context, &remote_iface_attr->bandwidth))) +
+                        remote_iface_attr->eff_bandwidth)) +
                 ucp_wireup_tl_iface_latency(context, iface_attr, remote_iface_attr) +
                 iface_attr->overhead + md_attr->reg_cost.overhead +
                 (UCP_WIREUP_RMA_BW_TEST_MSG_SIZE * md_attr->reg_cost.growth));
 }
 
-static int ucp_wireup_is_lane_proxy(ucp_ep_h ep, ucp_rsc_index_t rsc_index,
+UCP_WIREUP_SCORE_BATCH_FUNC(ucp_wireup_rma_bw_score_batch,
+                            ucp_wireup_rma_bw_score_func)
+
+static int ucp_wireup_is_lane_proxy(ucp_worker_h worker,
+                                    ucp_rsc_index_t rsc_index,
                                     uint64_t remote_cap_flags)
 {
-    return !ucp_worker_is_tl_p2p(ep->worker, rsc_index) &&
+    /* The p2p classification of every resource is precomputed in the worker
+     * p2p resource bitmap, so the proxy decision is two bit tests with no
+     * interface attribute lookup */
+    return !(worker->p2p_rsc_bitmap & UCS_BIT(rsc_index)) &&
            ((remote_cap_flags & UCP_WORKER_UCT_RECV_EVENT_CAP_FLAGS) ==
             UCT_IFACE_FLAG_EVENT_RECV_SIG);
 }
@@ -856,9 +1413,6 @@ static int ucp_wireup_is_lane_proxy(ucp_ep_h ep, ucp_rsc_index_t rsc_index,
 static inline int
 ucp_wireup_is_am_required(const ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_ep_h ep = select_ctx->ep;
-    ucp_lane_index_t lane;
-
     /* Check if we need active messages from the configurations, for wireup.
      * If not, check if am is required due to p2p transports */
 
@@ -868,26 +1422,29 @@ ucp_wireup_is_am_required(const ucp_wireup_select_ctx_t *select_ctx)
     }
 
     if (!(select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) &&
-        (ucp_ep_get_context_features(ep) & (UCP_FEATURE_TAG | 
-                                            UCP_FEATURE_STREAM | 
-                                            UCP_FEATURE_AM))) {
+        (select_ctx->features & (UCP_FEATURE_TAG |
+                                 UCP_FEATURE_STREAM |
+                                 UCP_FEATURE_AM))) {
         return 1;
     }
 
-    for (lane = 0; lane < select_ctx->num_lanes; ++lane) {
-        if (ucp_worker_is_tl_p2p(ep->worker,
-                                 select_ctx->lane_descs[lane].rsc_index)) {
-            return 1;
-        }
-    }
-
-    return 0;
+    /* The resources used by the lanes added so far are tracked in
+     * used_rsc_bitmap, so the p2p scan is a bitmap intersection */
+    return !!(select_ctx->used_rsc_bitmap & select_ctx->worker->p2p_rsc_bitmap);
 }
 
+static const ucp_wireup_criteria_t ucp_wireup_am_criteria_tmpl = {
+    .title              = "active messages",
+    .remote_iface_flags = UCT_IFACE_FLAG_AM_BCOPY |
+                          UCT_IFACE_FLAG_CB_SYNC,
+    .local_iface_flags  = UCT_IFACE_FLAG_AM_BCOPY,
+    .calc_score_batch   = ucp_wireup_am_score_batch
+};
+
 static ucs_status_t ucp_wireup_add_am_lane(ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_ep_h ep                    = select_ctx->ep;
-    ucp_wireup_criteria_t criteria = {0};
+    ucp_ep_h ep = select_ctx->ep;
+    ucp_wireup_criteria_t criteria;
     ucp_wireup_select_info_t *am_info;
     uint64_t remote_cap_flags;
     ucp_rsc_index_t dst_md_index;
@@ -899,34 +1456,32 @@ static ucs_status_t ucp_wireup_add_am_lane(ucp_wireup_select_ctx_t *select_ctx)
     }
 
     /* Select one lane for active messages */
-    criteria.title              = "active messages";
-    criteria.remote_iface_flags = UCT_IFACE_FLAG_AM_BCOPY |
-                                  UCT_IFACE_FLAG_CB_SYNC;
-    criteria.local_iface_flags  = UCT_IFACE_FLAG_AM_BCOPY;
-    criteria.calc_score         = ucp_wireup_am_score_func;
+    criteria = ucp_wireup_am_criteria_tmpl;
     ucp_wireup_fill_ep_params_criteria(&criteria, select_ctx->params);
 
-    if (ucs_test_all_flags(ucp_ep_get_context_features(ep),
+    if (ucs_test_all_flags(select_ctx->features,
                            UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP)) {
         criteria.local_iface_flags |= UCP_WORKER_UCT_UNSIG_EVENT_CAP_FLAGS;
     }
 
-    status = ucp_wireup_select_transport(ep, select_ctx->address_list,
-                                         select_ctx->address_count, &criteria,
-                                         -1, -1, -1, -1, 1, &select_ctx->am_info);
+    status = ucp_wireup_select_transport_eligible(
+                 ep, select_ctx->address_list, select_ctx->address_count,
+                 &criteria,
+                 ucp_wireup_eligible_rsc_bitmap(ep->worker, &criteria),
+                 select_ctx, -1, -1, -1, -1, 1, &select_ctx->am_info);
     if (status != UCS_OK) {
         return status;
     }
 
     am_info      = &select_ctx->am_info;
-    dst_md_index = select_ctx->address_list[am_info->addr_index].md_index;
+    dst_md_index = select_ctx->addr_md_index[am_info->addr_index];
 
     /* If the remote side is not p2p and has only signaled-am wakeup, it may
      * deactivate its interface and wait for signaled active message to wake up.
      * Use a proxy lane which would send the first active message as signaled to
      * make sure the remote interface will indeed wake up. */
-    remote_cap_flags = select_ctx->address_list[am_info->addr_index].iface_attr.cap_flags;
-    is_proxy         = ucp_wireup_is_lane_proxy(ep, am_info->rsc_index,
+    remote_cap_flags = select_ctx->addr_cap_flags[am_info->addr_index];
+    is_proxy         = ucp_wireup_is_lane_proxy(ep->worker, am_info->rsc_index,
                                                 remote_cap_flags);
 
     ucp_wireup_add_lane_desc(select_ctx, am_info, dst_md_index,
@@ -943,37 +1498,153 @@ static double ucp_wireup_am_bw_score_func(ucp_context_h context,
     /* best single MTU bandwidth */
     double size = iface_attr->cap.am.max_bcopy;
     double time = (size / ucs_min(ucp_tl_iface_bandwidth(context, &iface_attr->bandwidth),
-                                  ucp_tl_iface_bandwidth(context, &remote_iface_attr->bandwidth))) +
+                                  remote_iface_attr->eff_bandwidth)) +
                   iface_attr->overhead + remote_iface_attr->overhead +
                   ucp_wireup_tl_iface_latency(context, iface_attr, remote_iface_attr);
 
     return size / time * 1e-5;
 }
 
+UCP_WIREUP_SCORE_BATCH_FUNC(ucp_wireup_am_bw_score_batch,
+                            ucp_wireup_am_bw_score_func)
+
 int ucp_wireup_is_rsc_self_or_shm(ucp_ep_h ep, ucp_rsc_index_t rsc_index)
 {
-    return (ep->worker->context->tl_rscs[rsc_index].tl_rsc.dev_type == UCT_DEVICE_TYPE_SHM) ||
-           (ep->worker->context->tl_rscs[rsc_index].tl_rsc.dev_type == UCT_DEVICE_TYPE_SELF);
+    /* The SHM/SELF device classification is precomputed at context init */
+    return !!(ep->worker->context->self_shm_rsc_bitmap & UCS_BIT(rsc_index));
+}
+
+
+/* A scored (resource, address) candidate for bandwidth-lane selection */
+typedef struct {
+    double                score;      /* Selection score */
+    ucp_rsc_index_t       rsc_index;  /* Local resource index */
+    uint8_t               addr_index; /* Remote address index */
+    uint8_t               priority;   /* Summed local+remote priority */
+} ucp_wireup_candidate_t;
+
+static int ucp_wireup_candidate_better(const ucp_wireup_candidate_t *cand1,
+                                       const ucp_wireup_candidate_t *cand2)
+{
+    int cmp = ucp_wireup_score_cmp(cand1->score, cand2->score);
+
+    return (cmp > 0) || ((cmp == 0) && (cand1->priority > cand2->priority));
+}
+
+/* Collect all (resource, address) pairs which pass the criteria, with their
+ * scores, sorted from best to worst. The bandwidth-lane loop repeatedly
+ * selects under the same criteria while only pruning device bitmaps between
+ * iterations, so scoring every pair once and walking the sorted list replaces
+ * a full re-selection per lane. Device restrictions are left to the walk. */
+static unsigned
+ucp_wireup_collect_candidates(ucp_wireup_select_ctx_t *select_ctx,
+                              const ucp_wireup_criteria_t *criteria,
+                              uint64_t eligible_rsc_bitmap, uint64_t tl_bitmap,
+                              ucp_wireup_candidate_t *candidates)
+{
+    ucp_worker_h worker   = select_ctx->worker;
+    ucp_context_h context = select_ctx->context;
+    unsigned count        = 0;
+    double scores[UCP_WIREUP_MAX_ADDR_COUNT];
+    uct_iface_attr_t *iface_attr;
+    uct_md_attr_t *md_attr;
+    ucp_wireup_candidate_t cand;
+    uint64_t addr_index_map, reachable_map;
+    ucp_rsc_index_t rsc_index;
+    unsigned addr_index, i;
+
+    addr_index_map = ucp_wireup_criteria_addr_map(select_ctx, criteria);
+
+    ucs_for_each_bit(rsc_index,
+                     context->tl_bitmap & tl_bitmap & eligible_rsc_bitmap) {
+        reachable_map = addr_index_map &
+                        select_ctx->rsc_reachable_addrs[rsc_index];
+        if (!reachable_map) {
+            continue;
+        }
+
+        iface_attr = ucp_worker_iface_get_attr(worker, rsc_index);
+        md_attr    = &context->tl_mds[select_ctx->tl_rscs[rsc_index].md_index].attr;
+
+        criteria->calc_score_batch(context, md_attr, iface_attr,
+                                   select_ctx->address_list, reachable_map,
+                                   scores);
+
+        ucs_for_each_bit(addr_index, reachable_map) {
+            cand.score      = scores[addr_index];
+            cand.rsc_index  = rsc_index;
+            cand.addr_index = addr_index;
+            cand.priority   = iface_attr->priority +
+                              select_ctx->address_list[addr_index].iface_attr.priority;
+
+            /* Insert in descending order (stable) */
+            for (i = count; (i > 0) &&
+                            ucp_wireup_candidate_better(&cand,
+                                                        &candidates[i - 1]);
+                 --i) {
+                candidates[i] = candidates[i - 1];
+            }
+            candidates[i] = cand;
+            ++count;
+        }
+    }
+
+    return count;
 }
 
+/* Allocate and fill the sorted candidate list for a bandwidth-lane walk.
+ * Collecting is separated from the walk itself, so callers which walk the
+ * same criteria several times with different resource restrictions (one per
+ * memory type) score every (resource, address) pair only once. */
 static ucs_status_t
+ucp_wireup_collect_bw_candidates(ucp_wireup_select_ctx_t *select_ctx,
+                                 const ucp_wireup_select_bw_info_t *bw_info,
+                                 ucp_wireup_candidate_t **candidates_p,
+                                 unsigned *num_candidates_p)
+{
+    ucp_context_h context = select_ctx->context;
+    ucp_wireup_candidate_t *candidates;
+    uint64_t eligible_rsc_bitmap;
+
+    candidates = ucs_malloc(context->num_tls * select_ctx->address_count *
+                            sizeof(*candidates), "ucp_wireup_bw_candidates");
+    if (candidates == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    eligible_rsc_bitmap = ucp_wireup_eligible_rsc_bitmap(select_ctx->worker,
+                                                         &bw_info->criteria);
+    *num_candidates_p   = ucp_wireup_collect_candidates(select_ctx,
+                                                        &bw_info->criteria,
+                                                        eligible_rsc_bitmap, -1,
+                                                        candidates);
+    *candidates_p       = candidates;
+    return UCS_OK;
+}
+
+static void
 ucp_wireup_add_bw_lanes(ucp_wireup_select_ctx_t *select_ctx,
                         const ucp_wireup_select_bw_info_t *bw_info,
-                        int allow_proxy, uint64_t tl_bitmap)
+                        int allow_proxy,
+                        const ucp_wireup_candidate_t *candidates,
+                        unsigned num_candidates, uint64_t tl_bitmap)
 {
     ucp_ep_h ep                          = select_ctx->ep;
-    ucp_context_h context                = ep->worker->context;
+    ucp_context_h context                = select_ctx->context;
     ucp_wireup_select_info_t select_info = {0};
-    ucs_status_t status;
+    const ucp_wireup_candidate_t *cand;
     int num_lanes;
     ucp_rsc_index_t dst_md_index;
     uint64_t local_dev_bitmap;
     uint64_t remote_dev_bitmap;
     uint64_t remote_cap_flags;
     ucp_md_map_t md_map;
+    uint64_t shm_break;
+    unsigned i;
     int is_proxy;
 
     num_lanes         = 0;
+    shm_break         = 0;
     md_map            = bw_info->md_map;
     local_dev_bitmap  = bw_info->local_dev_bitmap;
     remote_dev_bitmap = bw_info->remote_dev_bitmap;
@@ -981,73 +1652,77 @@ ucp_wireup_add_bw_lanes(ucp_wireup_select_ctx_t *select_ctx,
     /* lookup for requested number of lanes or limit of MD map
      * (we have to limit MD's number to avoid malloc in
      * memory registration) */
-    while ((num_lanes < bw_info->max_lanes) &&
-           (ucs_popcount(md_map) < UCP_MAX_OP_MDS)) {
-        status = ucp_wireup_select_transport(ep, select_ctx->address_list,
-                                             select_ctx->address_count,
-                                             &bw_info->criteria, tl_bitmap, -1,
-                                             local_dev_bitmap, remote_dev_bitmap,
-                                             0, &select_info);
-        if (status != UCS_OK) {
-            break;
+    for (i = 0; (i < num_candidates) && (num_lanes < bw_info->max_lanes) &&
+                (ucs_popcount(md_map) < UCP_MAX_OP_MDS) && !shm_break; ++i) {
+        cand = &candidates[i];
+
+        if (!(tl_bitmap & UCS_BIT(cand->rsc_index))) {
+            continue;
+        }
+
+        /* Shift the relevant bit of each device bitmap down to position 0
+         * and test both with a single AND, instead of two data-dependent
+         * branches */
+        if (!((local_dev_bitmap >>
+               select_ctx->tl_rscs[cand->rsc_index].dev_index) &
+              (remote_dev_bitmap >>
+               select_ctx->addr_dev_index[cand->addr_index]) & 1)) {
+            continue;
         }
 
-        remote_cap_flags = select_ctx->address_list[select_info.addr_index].iface_attr.cap_flags;
+        select_info.rsc_index  = cand->rsc_index;
+        select_info.addr_index = cand->addr_index;
+        select_info.score      = cand->score;
+
+        remote_cap_flags = select_ctx->addr_cap_flags[select_info.addr_index];
         is_proxy         = (allow_proxy &&
-                            ucp_wireup_is_lane_proxy(ep, select_info.rsc_index,
+                            ucp_wireup_is_lane_proxy(ep->worker,
+                                                     select_info.rsc_index,
                                                      remote_cap_flags));
-        dst_md_index     = select_ctx->address_list[select_info.addr_index].md_index;
+        dst_md_index     = select_ctx->addr_md_index[select_info.addr_index];
 
         ucp_wireup_add_lane_desc(select_ctx, &select_info, dst_md_index,
                                  bw_info->usage, is_proxy);
-        md_map |= UCS_BIT(context->tl_rscs[select_info.rsc_index].md_index);
+        md_map |= UCS_BIT(select_ctx->tl_rscs[select_info.rsc_index].md_index);
         num_lanes++;
 
-        local_dev_bitmap  &= ~UCS_BIT(context->tl_rscs[select_info.rsc_index].dev_index);
-        remote_dev_bitmap &= ~UCS_BIT(select_ctx->address_list[select_info.addr_index].dev_index);
+        local_dev_bitmap  &= ~UCS_BIT(select_ctx->tl_rscs[select_info.rsc_index].dev_index);
+        remote_dev_bitmap &= ~UCS_BIT(select_ctx->addr_dev_index[select_info.addr_index]);
 
-        if (ucp_wireup_is_rsc_self_or_shm(ep, select_info.rsc_index)) {
-            /* special case for SHM: do not try to lookup additional lanes when
-             * SHM transport detected (another transport will be significantly
-             * slower) */
-            break;
-        }
+        /* special case for SHM: do not try to lookup additional lanes when
+         * SHM transport detected (another transport will be significantly
+         * slower). Folded into the loop condition to keep a single exit. */
+        shm_break = context->self_shm_rsc_bitmap & UCS_BIT(select_info.rsc_index);
     }
-
-    return UCS_OK;
 }
 
+static const ucp_wireup_criteria_t ucp_wireup_am_bw_criteria_tmpl = {
+    .title              = "high-bw active messages",
+    .remote_iface_flags = UCT_IFACE_FLAG_AM_BCOPY |
+                          UCT_IFACE_FLAG_CB_SYNC,
+    .local_iface_flags  = UCT_IFACE_FLAG_AM_BCOPY,
+    .calc_score_batch   = ucp_wireup_am_bw_score_batch
+};
+
 static ucs_status_t
 ucp_wireup_add_am_bw_lanes(ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_ep_h ep           = select_ctx->ep; 
-    ucp_context_h context = ep->worker->context;
+    ucp_ep_h ep           = select_ctx->ep;
+    ucp_context_h context = select_ctx->context;
     ucp_wireup_select_bw_info_t bw_info;
+    ucp_wireup_candidate_t *candidates;
+    unsigned num_candidates;
     ucp_lane_index_t lane_desc_idx;
     ucp_rsc_index_t rsc_index;
+    ucs_status_t status;
     unsigned addr_index;
 
-    /* Check if we need active messages, for wireup */
-    if (!(ucp_ep_get_context_features(ep) & UCP_FEATURE_TAG) ||
-        (select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) ||
-        (context->config.ext.max_eager_lanes < 2)) {
-        return UCS_OK;
-    }
-
     /* Select one lane for active messages */
-    bw_info.criteria.title              = "high-bw active messages";
-    bw_info.criteria.local_md_flags     = 0;
-    bw_info.criteria.remote_md_flags    = 0;
-    bw_info.criteria.remote_iface_flags = UCT_IFACE_FLAG_AM_BCOPY |
-                                          UCT_IFACE_FLAG_CB_SYNC;
-    bw_info.criteria.local_iface_flags  = UCT_IFACE_FLAG_AM_BCOPY;
-    bw_info.criteria.calc_score         = ucp_wireup_am_bw_score_func;
-    bw_info.criteria.tl_rsc_flags       = 0;
-    ucp_wireup_clean_amo_criteria(&bw_info.criteria);
+    bw_info.criteria = ucp_wireup_am_bw_criteria_tmpl;
     ucp_wireup_fill_ep_params_criteria(&bw_info.criteria,
                                        select_ctx->params);
 
-    if (ucs_test_all_flags(ucp_ep_get_context_features(ep),
+    if (ucs_test_all_flags(select_ctx->features,
                            UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP)) {
         bw_info.criteria.local_iface_flags |= UCP_WORKER_UCT_UNSIG_EVENT_CAP_FLAGS;
     }
@@ -1063,9 +1738,9 @@ ucp_wireup_add_am_bw_lanes(ucp_wireup_select_ctx_t *select_ctx)
         if (select_ctx->lane_descs[lane_desc_idx].usage & UCP_WIREUP_LANE_USAGE_AM) {
             addr_index                 = select_ctx->lane_descs[lane_desc_idx].addr_index;
             rsc_index                  = select_ctx->lane_descs[lane_desc_idx].rsc_index;
-            bw_info.md_map            |= UCS_BIT(context->tl_rscs[rsc_index].md_index);
-            bw_info.local_dev_bitmap  &= ~UCS_BIT(context->tl_rscs[rsc_index].dev_index);
-            bw_info.remote_dev_bitmap &= ~UCS_BIT(select_ctx->address_list[addr_index].dev_index);
+            bw_info.md_map            |= UCS_BIT(select_ctx->tl_rscs[rsc_index].md_index);
+            bw_info.local_dev_bitmap  &= ~UCS_BIT(select_ctx->tl_rscs[rsc_index].dev_index);
+            bw_info.remote_dev_bitmap &= ~UCS_BIT(select_ctx->addr_dev_index[addr_index]);
             if (ucp_wireup_is_rsc_self_or_shm(ep, rsc_index)) {
                 /* if AM lane is SELF or SHMEM - then do not use more lanes */
                 return UCS_OK;
@@ -1076,40 +1751,53 @@ ucp_wireup_add_am_bw_lanes(ucp_wireup_select_ctx_t *select_ctx)
         }
     }
 
-    return ucp_wireup_add_bw_lanes(select_ctx, &bw_info, 1, -1);
+    status = ucp_wireup_collect_bw_candidates(select_ctx, &bw_info,
+                                              &candidates, &num_candidates);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    ucp_wireup_add_bw_lanes(select_ctx, &bw_info, 1, candidates,
+                            num_candidates, -1);
+    ucs_free(candidates);
+    return UCS_OK;
 }
 
+static const ucp_wireup_criteria_t ucp_wireup_rma_bw_criteria_tmpl = {
+    .title              = "high-bw remote memory access",
+    .remote_iface_flags = UCT_IFACE_FLAG_GET_ZCOPY |
+                          UCT_IFACE_FLAG_PUT_ZCOPY,
+    .local_iface_flags  = UCT_IFACE_FLAG_GET_ZCOPY |
+                          UCT_IFACE_FLAG_PUT_ZCOPY |
+                          UCT_IFACE_FLAG_PENDING,
+    .calc_score_batch   = ucp_wireup_rma_bw_score_batch
+};
+
 static ucs_status_t
 ucp_wireup_add_rma_bw_lanes(ucp_wireup_select_ctx_t *select_ctx)
 {
-    ucp_ep_h ep           = select_ctx->ep;
-    ucp_context_h context = ep->worker->context;
+    ucp_context_h context = select_ctx->context;
     ucp_wireup_select_bw_info_t bw_info;
+    ucp_wireup_candidate_t *candidates;
+    unsigned num_candidates;
     ucs_memory_type_t mem_type;
+    ucs_status_t status;
+    uint64_t md_flags;
 
     if (select_ctx->ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) {
-        bw_info.criteria.remote_md_flags = 0;
-        bw_info.criteria.local_md_flags  = 0;
-    } else if (ucp_ep_get_context_features(ep) & UCP_FEATURE_TAG) {
-        /* if needed for RNDV, need only access for remote registered memory */
-        bw_info.criteria.remote_md_flags = UCT_MD_FLAG_REG;
-        bw_info.criteria.local_md_flags  = UCT_MD_FLAG_REG;
+        md_flags = 0;
     } else {
-        return UCS_OK;
+        /* if needed for RNDV, need only access for remote registered memory */
+        md_flags = UCT_MD_FLAG_REG;
     }
 
-    bw_info.criteria.title              = "high-bw remote memory access";
-    bw_info.criteria.remote_iface_flags = UCT_IFACE_FLAG_GET_ZCOPY |
-                                          UCT_IFACE_FLAG_PUT_ZCOPY;
-    bw_info.criteria.local_iface_flags  = bw_info.criteria.remote_iface_flags |
-                                          UCT_IFACE_FLAG_PENDING;
-    bw_info.criteria.calc_score         = ucp_wireup_rma_bw_score_func;
-    bw_info.criteria.tl_rsc_flags       = 0;
-    ucp_wireup_clean_amo_criteria(&bw_info.criteria);
+    bw_info.criteria                 = ucp_wireup_rma_bw_criteria_tmpl;
+    bw_info.criteria.remote_md_flags = md_flags;
+    bw_info.criteria.local_md_flags  = md_flags;
     ucp_wireup_fill_ep_params_criteria(&bw_info.criteria,
                                        select_ctx->params);
 
-    if (ucs_test_all_flags(ucp_ep_get_context_features(ep),
+    if (ucs_test_all_flags(select_ctx->features,
                            UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP)) {
         bw_info.criteria.local_iface_flags |= UCP_WORKER_UCT_UNSIG_EVENT_CAP_FLAGS;
     }
@@ -1120,60 +1808,70 @@ ucp_wireup_add_rma_bw_lanes(ucp_wireup_select_ctx_t *select_ctx)
     bw_info.max_lanes         = context->config.ext.max_rndv_lanes;
     bw_info.usage             = UCP_WIREUP_LANE_USAGE_RMA_BW;
 
+    /* The per-memory-type walks differ only in which resources they may
+     * use, so the scored candidate list is collected once and each walk
+     * restricts it with the memory-type access bitmap */
+    status = ucp_wireup_collect_bw_candidates(select_ctx, &bw_info,
+                                              &candidates, &num_candidates);
+    if (status != UCS_OK) {
+        return status;
+    }
+
     for (mem_type = 0; mem_type < UCS_MEMORY_TYPE_LAST; mem_type++) {
         if (!context->mem_type_access_tls[mem_type]) {
             continue;
         }
 
-        ucp_wireup_add_bw_lanes(select_ctx, &bw_info, 0,
+        ucp_wireup_add_bw_lanes(select_ctx, &bw_info, 0, candidates,
+                                num_candidates,
                                 context->mem_type_access_tls[mem_type]);
     }
 
+    ucs_free(candidates);
     return UCS_OK;
 }
 
+static const ucp_wireup_criteria_t ucp_wireup_tag_criteria_tmpl = {
+    .title              = "tag_offload",
+    .local_md_flags     = UCT_MD_FLAG_REG, /* needed for posting tags to HW */
+    .remote_md_flags    = UCT_MD_FLAG_REG, /* needed for posting tags to HW */
+    .remote_iface_flags = UCT_IFACE_FLAG_TAG_EAGER_BCOPY |
+                          UCT_IFACE_FLAG_TAG_RNDV_ZCOPY  |
+                          UCT_IFACE_FLAG_GET_ZCOPY       |
+                          UCT_IFACE_FLAG_PENDING,
+    .local_iface_flags  = UCT_IFACE_FLAG_TAG_EAGER_BCOPY |
+                          UCT_IFACE_FLAG_TAG_RNDV_ZCOPY  |
+                          UCT_IFACE_FLAG_GET_ZCOPY       |
+                          UCT_IFACE_FLAG_PENDING,
+    .calc_score_batch   = ucp_wireup_am_score_batch
+};
+
 /* Lane for transport offloaded tag interface */
 static ucs_status_t
-ucp_wireup_add_tag_lane(ucp_wireup_select_ctx_t *select_ctx,
-                        ucp_err_handling_mode_t err_mode)
+ucp_wireup_add_tag_lane(ucp_wireup_select_ctx_t *select_ctx)
 {
     ucp_ep_h ep                          = select_ctx->ep;
-    ucp_wireup_criteria_t criteria       = {0};
     ucp_wireup_select_info_t select_info = {0};
+    ucp_wireup_criteria_t criteria;
     uint64_t remote_cap_flags;
     ucp_rsc_index_t dst_md_index;
     ucs_status_t status;
     int is_proxy;
 
-    if (!(ucp_ep_get_context_features(ep) & UCP_FEATURE_TAG) ||
-        /* TODO: remove check below when UCP_ERR_HANDLING_MODE_PEER supports
-         *       RNDV-protocol or HW TM supports fragmented protocols
-         */
-        (err_mode != UCP_ERR_HANDLING_MODE_NONE)) {
-        return UCS_OK;
-    }
-
-    criteria.title              = "tag_offload";
-    criteria.local_md_flags     = UCT_MD_FLAG_REG; /* needed for posting tags to HW */
-    criteria.remote_md_flags    = UCT_MD_FLAG_REG; /* needed for posting tags to HW */
-    criteria.remote_iface_flags = /* the same as local_iface_flags */
-    criteria.local_iface_flags  = UCT_IFACE_FLAG_TAG_EAGER_BCOPY |
-                                  UCT_IFACE_FLAG_TAG_RNDV_ZCOPY  |
-                                  UCT_IFACE_FLAG_GET_ZCOPY       |
-                                  UCT_IFACE_FLAG_PENDING;
-    criteria.calc_score         = ucp_wireup_am_score_func;
+    criteria = ucp_wireup_tag_criteria_tmpl;
 
-    if (ucs_test_all_flags(ucp_ep_get_context_features(ep),
+    if (ucs_test_all_flags(select_ctx->features,
                            UCP_FEATURE_WAKEUP)) {
         criteria.local_iface_flags |= UCP_WORKER_UCT_UNSIG_EVENT_CAP_FLAGS;
     }
 
     /* Do not add tag offload lane, if selected tag lane score is lower
      * than AM score. In this case AM will be used for tag macthing. */
-    status = ucp_wireup_select_transport(ep, select_ctx->address_list,
-                                         select_ctx->address_count,
-                                         &criteria, -1, -1, -1, -1, 0,
-                                         &select_info);
+    status = ucp_wireup_select_transport_eligible(
+                 ep, select_ctx->address_list, select_ctx->address_count,
+                 &criteria,
+                 ucp_wireup_eligible_rsc_bitmap(ep->worker, &criteria),
+                 select_ctx, -1, -1, -1, -1, 0, &select_info);
     /* Break if: */
     /* - transport selection wasn't OK */
     if ((status != UCS_OK) ||
@@ -1187,10 +1885,11 @@ ucp_wireup_add_tag_lane(ucp_wireup_select_ctx_t *select_ctx,
      * deactivate its interface and wait for signaled tag message to wake up.
      * Use a proxy lane which would send the first tag message as signaled to
      * make sure the remote interface will indeed wake up. */
-    remote_cap_flags = select_ctx->address_list[select_info.addr_index].iface_attr.cap_flags;
-    is_proxy         = ucp_wireup_is_lane_proxy(ep, select_info.rsc_index,
+    remote_cap_flags = select_ctx->addr_cap_flags[select_info.addr_index];
+    is_proxy         = ucp_wireup_is_lane_proxy(ep->worker,
+                                                select_info.rsc_index,
                                                 remote_cap_flags);
-    dst_md_index     = select_ctx->address_list[select_info.addr_index].md_index;
+    dst_md_index     = select_ctx->addr_md_index[select_info.addr_index];
 
     ucp_wireup_add_lane_desc(select_ctx, &select_info, dst_md_index,
                              UCP_WIREUP_LANE_USAGE_TAG, is_proxy);
@@ -1200,108 +1899,227 @@ out:
 }
 
 static ucp_lane_index_t
-ucp_wireup_select_wireup_msg_lane(ucp_worker_h worker,
-                                  const ucp_ep_params_t *ep_params,
-                                  const ucp_address_entry_t *address_list,
-                                  const ucp_wireup_lane_desc_t *lane_descs,
+ucp_wireup_select_wireup_msg_lane(const ucp_wireup_select_ctx_t *select_ctx,
                                   ucp_lane_index_t num_lanes)
 {
-    ucp_context_h context          = worker->context;
-    ucp_lane_index_t p2p_lane      = UCP_NULL_LANE;
-    ucp_wireup_criteria_t criteria = {0};
-    uct_tl_resource_desc_t *resource;
-    ucp_rsc_index_t rsc_index;
-    uct_iface_attr_t *attrs;
+    ucp_lane_index_t p2p_lane = UCP_NULL_LANE;
+    const ucp_wireup_lane_desc_t *lane_desc;
     ucp_lane_index_t lane;
-    unsigned addr_index;
 
-    ucp_wireup_fill_aux_criteria(&criteria, ep_params);
+    /* The aux capability of every lane was precomputed when the lane was
+     * added, so the scan is a bit test per lane without re-checking the
+     * interface capability flags */
     for (lane = 0; lane < num_lanes; ++lane) {
-        rsc_index  = lane_descs[lane].rsc_index;
-        addr_index = lane_descs[lane].addr_index;
-        resource   = &context->tl_rscs[rsc_index].tl_rsc;
-        attrs      = ucp_worker_iface_get_attr(worker, rsc_index);
-
-        /* if the current lane satisfies the wireup criteria, choose it for wireup.
-         * if it doesn't take a lane with a p2p transport */
-        if (ucp_wireup_check_flags(resource,
-                                   attrs->cap.flags,
-                                   criteria.local_iface_flags, criteria.title,
-                                   ucp_wireup_iface_flags, NULL, 0) &&
-            ucp_wireup_check_flags(resource,
-                                   address_list[addr_index].iface_attr.cap_flags,
-                                   criteria.remote_iface_flags, criteria.title,
-                                   ucp_wireup_iface_flags, NULL, 0))
-         {
-             return lane;
-         } else if (ucp_worker_is_tl_p2p(worker, rsc_index)) {
-             p2p_lane = lane;
-         }
+        lane_desc = &select_ctx->lane_descs[lane];
+
+        /* if the current lane satisfies the wireup criteria, choose it for
+         * wireup. if it doesn't take a lane with a p2p transport */
+        if (lane_desc->aux_caps ==
+            (UCP_WIREUP_AUX_CAP_LOCAL | UCP_WIREUP_AUX_CAP_REMOTE)) {
+            return lane;
+        } else if (select_ctx->worker->p2p_rsc_bitmap &
+                   UCS_BIT(lane_desc->rsc_index)) {
+            p2p_lane = lane;
+        }
     }
 
     return p2p_lane;
 }
 
+/* Resolve reachability of every (resource, remote address) pair once per
+ * selection. The matrix is intersected with the candidate address bitmap on
+ * every subsequent transport selection, so the repeated selections done by
+ * the memaccess/bw lane loops pay a single AND per resource instead of a
+ * name-checksum compare and a uct_iface_is_reachable() call per address. */
+static UCS_F_NOINLINE void
+ucp_wireup_build_reachability_matrix(ucp_wireup_select_ctx_t *select_ctx)
+{
+    ucp_worker_h worker   = select_ctx->worker;
+    ucp_context_h context = select_ctx->context;
+    uint16_t tl_name_csums[UCP_WIREUP_MAX_ADDR_COUNT];
+    const ucp_address_entry_t *ae;
+    uint64_t reachable_map;
+    uint16_t tl_name_csum;
+    ucp_worker_iface_t *wiface;
+    ucp_rsc_index_t rsc_index;
+    unsigned addr_index;
+
+    ucs_assert(select_ctx->address_count <= UCP_WIREUP_MAX_ADDR_COUNT);
+
+    /* Stage the transport name checksums into a compact array, so the
+     * per-resource scan below streams 2 bytes per address instead of the
+     * whole address entry, and dereferences the entry only for the few
+     * same-transport candidates which reach uct_iface_is_reachable() */
+    for (addr_index = 0; addr_index < select_ctx->address_count;
+         ++addr_index) {
+        tl_name_csums[addr_index] =
+            select_ctx->address_list[addr_index].tl_name_csum;
+    }
+
+    memset(select_ctx->rsc_reachable_addrs, 0,
+           sizeof(select_ctx->rsc_reachable_addrs));
+
+    ucs_for_each_bit(rsc_index, context->tl_bitmap) {
+        tl_name_csum  = select_ctx->tl_rscs[rsc_index].tl_name_csum;
+        wiface        = ucp_worker_iface(worker, rsc_index);
+        reachable_map = 0;
+
+        for (addr_index = 0; addr_index < select_ctx->address_count;
+             ++addr_index) {
+            if (tl_name_csums[addr_index] != tl_name_csum) {
+                continue;
+            }
+
+            ae = &select_ctx->address_list[addr_index];
+            if (uct_iface_is_reachable(wiface->iface, ae->dev_addr,
+                                       ae->iface_addr)) {
+                reachable_map |= UCS_BIT(addr_index);
+            }
+        }
+
+        select_ctx->rsc_reachable_addrs[rsc_index] = reachable_map;
+    }
+}
+
+/* Derive in one pass which lane usage classes the endpoint configuration may
+ * need, as a bitmask of UCP_WIREUP_LANE_USAGE_* bits. The per-class entry
+ * checks which used to open every add_*_lanes function then reduce to single
+ * bit tests in ucp_wireup_search_lanes(). */
+static uint32_t
+ucp_wireup_needed_lane_classes(const ucp_wireup_select_ctx_t *select_ctx)
+{
+    uint64_t features = select_ctx->features;
+    int mem_type      = !!(select_ctx->ep_init_flags &
+                           UCP_EP_INIT_FLAG_MEM_TYPE);
+    uint32_t needed   = 0;
+
+    if ((features & UCP_FEATURE_RMA) || mem_type) {
+        needed |= UCP_WIREUP_LANE_USAGE_RMA;
+    }
+
+    if (ucs_test_flags(features, UCP_FEATURE_AMO32, UCP_FEATURE_AMO64) &&
+        !mem_type) {
+        needed |= UCP_WIREUP_LANE_USAGE_AMO;
+    }
+
+    /* The AM requirement is partially dynamic - it also depends on whether
+     * the preceding classes selected p2p resources - so the final decision
+     * stays in ucp_wireup_is_am_required() */
+    needed |= UCP_WIREUP_LANE_USAGE_AM;
+
+    if (mem_type || (features & UCP_FEATURE_TAG)) {
+        needed |= UCP_WIREUP_LANE_USAGE_RMA_BW;
+    }
+
+    /* TODO: remove the error mode check when UCP_ERR_HANDLING_MODE_PEER
+     *       supports RNDV-protocol or HW TM supports fragmented protocols */
+    if ((features & UCP_FEATURE_TAG) &&
+        (select_ctx->err_mode == UCP_ERR_HANDLING_MODE_NONE)) {
+        needed |= UCP_WIREUP_LANE_USAGE_TAG;
+    }
+
+    if ((features & UCP_FEATURE_TAG) && !mem_type &&
+        (select_ctx->context->config.ext.max_eager_lanes >= 2)) {
+        needed |= UCP_WIREUP_LANE_USAGE_AM_BW;
+    }
+
+    return needed;
+}
+
 static UCS_F_NOINLINE void
 ucp_wireup_select_ctx_init(ucp_wireup_select_ctx_t *select_ctx,
                            ucp_ep_h ep, const ucp_ep_params_t *params,
                            unsigned ep_init_flags, unsigned address_count,
-                           const ucp_address_entry_t *address_list)
+                           const ucp_address_entry_t *address_list,
+                           uint8_t *addr_indices, ucp_ep_config_key_t *key)
 {
+    ucp_wireup_criteria_t aux_criteria;
+    unsigned addr_index;
+    unsigned i;
+
     select_ctx->ep                 = ep;
+    select_ctx->worker             = ep->worker;
+    select_ctx->context            = ep->worker->context;
+    select_ctx->tl_rscs            = ep->worker->context->tl_rscs;
+    select_ctx->features           = ep->worker->context->config.features;
     select_ctx->params             = params;
     select_ctx->ep_init_flags      = ep_init_flags;
     select_ctx->address_list       = address_list;
     select_ctx->address_count      = address_count;
     select_ctx->num_lanes          = 0;
+    select_ctx->used_rsc_bitmap    = 0;
+    select_ctx->used_addr_bitmap   = 0;
     select_ctx->allow_am           =
         ucp_wireup_allow_am_emulation_layer(params, ep_init_flags);
-    memset(select_ctx->lane_descs, 0, sizeof(select_ctx->lane_descs));
-}
+    select_ctx->err_mode           = key->err_mode;
+    select_ctx->key                = key;
+    select_ctx->addr_indices       = addr_indices;
+    select_ctx->needed_lane_classes = ucp_wireup_needed_lane_classes(select_ctx);
 
-static UCS_F_NOINLINE ucs_status_t
-ucp_wireup_search_lanes(ucp_wireup_select_ctx_t *select_ctx,
-                        const ucp_ep_config_key_t *key)
-{
-    ucs_status_t status;
-
-    status = ucp_wireup_add_rma_lanes(select_ctx);
-    if (status != UCS_OK) {
-        return status;
+    for (i = 0; i < ucs_array_size(select_ctx->addr_filter_cache); ++i) {
+        select_ctx->addr_filter_cache[i].valid = 0;
     }
-
-    status = ucp_wireup_add_amo_lanes(select_ctx);
-    if (status != UCS_OK) {
-        return status;
+    select_ctx->addr_filter_cache_lru = 0;
+
+    ucp_wireup_fill_aux_criteria(&aux_criteria, params);
+    select_ctx->aux_local_iface_flags  = aux_criteria.local_iface_flags;
+    select_ctx->aux_remote_iface_flags = aux_criteria.remote_iface_flags;
+
+    /* Shadow the hot per-address fields into compact arrays, so the
+     * selection walks below read a few bytes per address instead of pulling
+     * a whole address entry per field access */
+    ucs_assert(address_count <= UCP_WIREUP_MAX_ADDR_COUNT);
+    for (addr_index = 0; addr_index < address_count; ++addr_index) {
+        select_ctx->addr_cap_flags[addr_index] =
+            address_list[addr_index].iface_attr.cap_flags;
+        select_ctx->addr_md_index[addr_index]  =
+            address_list[addr_index].md_index;
+        select_ctx->addr_dev_index[addr_index] =
+            address_list[addr_index].dev_index;
     }
+    /* lane_descs/lane_keys entries are fully initialized by
+     * ucp_wireup_add_lane_desc() and never read past num_lanes, so there is
+     * no need to zero the whole arrays up front */
 
-    status = ucp_wireup_add_am_lane(select_ctx);
-    if (status != UCS_OK) {
-        return status;
-    }
+    ucp_wireup_build_reachability_matrix(select_ctx);
+}
 
-    status = ucp_wireup_add_rma_bw_lanes(select_ctx);
-    if (status != UCS_OK) {
-        return status;
-    }
+static UCS_F_NOINLINE ucs_status_t
+ucp_wireup_search_lanes(ucp_wireup_select_ctx_t *select_ctx)
+{
+    /* Lane classes in selection order, gated by the precomputed needed-class
+     * mask. Note that ucp_wireup_add_am_bw_lanes must run after
+     * ucp_wireup_add_am_lane to allow excluding the AM lane from the AM_BW
+     * list. */
+    static const struct {
+        uint32_t     usage;
+        ucs_status_t (*add_lanes)(ucp_wireup_select_ctx_t*);
+    } lane_classes[] = {
+        {UCP_WIREUP_LANE_USAGE_RMA,    ucp_wireup_add_rma_lanes},
+        {UCP_WIREUP_LANE_USAGE_AMO,    ucp_wireup_add_amo_lanes},
+        {UCP_WIREUP_LANE_USAGE_AM,     ucp_wireup_add_am_lane},
+        {UCP_WIREUP_LANE_USAGE_RMA_BW, ucp_wireup_add_rma_bw_lanes},
+        {UCP_WIREUP_LANE_USAGE_TAG,    ucp_wireup_add_tag_lane},
+        {UCP_WIREUP_LANE_USAGE_AM_BW,  ucp_wireup_add_am_bw_lanes}
+    };
+    ucs_status_t status;
+    unsigned i;
 
-    status = ucp_wireup_add_tag_lane(select_ctx, key->err_mode);
-    if (status != UCS_OK) {
-        return status;
-    }
+    for (i = 0; i < ucs_array_size(lane_classes); ++i) {
+        if (!(select_ctx->needed_lane_classes & lane_classes[i].usage)) {
+            continue;
+        }
 
-    /* call ucp_wireup_add_am_bw_lanes after ucp_wireup_add_am_lane to
-     * allow exclude AM lane from AM_BW list */
-    status = ucp_wireup_add_am_bw_lanes(select_ctx);
-    if (status != UCS_OK) {
-        return status;
+        status = lane_classes[i].add_lanes(select_ctx);
+        if (status != UCS_OK) {
+            return status;
+        }
     }
 
     /* User should not create endpoints unless requested communication features */
     if (select_ctx->num_lanes == 0) {
         ucs_error("No transports selected to %s (features: 0x%lx)",
-                  ucp_ep_peer_name(select_ctx->ep),
-                  ucp_ep_get_context_features(select_ctx->ep));
+                  ucp_ep_peer_name(select_ctx->ep), select_ctx->features);
         return UCS_ERR_UNREACHABLE;
     }
 
@@ -1310,68 +2128,69 @@ ucp_wireup_search_lanes(ucp_wireup_select_ctx_t *select_ctx,
 
 static UCS_F_NOINLINE void
 ucp_wireup_construct_lanes(ucp_wireup_select_ctx_t *select_ctx,
-                           uint8_t *addr_indices, ucp_ep_config_key_t *key)
+                           ucp_ep_config_key_t *key)
 {
-    ucp_ep_h ep           = select_ctx->ep;
-    ucp_worker_h worker   = ep->worker;
-    ucp_context_h context = worker->context;
+    ucp_context_h context = select_ctx->context;
     ucp_rsc_index_t rsc_index;
     ucp_md_index_t md_index;
     ucp_lane_index_t lane;
     ucp_lane_index_t i;
+    uint32_t usage;
 
     key->num_lanes = select_ctx->num_lanes;
-    /* Construct the endpoint configuration key:
-     * - arrange lane description in the EP configuration
+    /* Construct the endpoint configuration key. The per-lane fields
+     * (rsc_index, proxy_lane, dst_md_index and the address index output)
+     * were already written in place by ucp_wireup_add_lane_desc(), so this
+     * pass only routes the lanes by their final usage:
      * - create remote MD bitmap
      * - if AM lane exists and fits for wireup messages, select it for this purpose.
      */
     for (lane = 0; lane < key->num_lanes; ++lane) {
-        ucs_assert(select_ctx->lane_descs[lane].usage != 0);
-        key->lanes[lane].rsc_index    = select_ctx->lane_descs[lane].rsc_index;
-        key->lanes[lane].proxy_lane   = select_ctx->lane_descs[lane].proxy_lane;
-        key->lanes[lane].dst_md_index = select_ctx->lane_descs[lane].dst_md_index;
-        addr_indices[lane]            = select_ctx->lane_descs[lane].addr_index;
-
-        if (select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_AM) {
-            ucs_assert(key->am_lane == UCP_NULL_LANE);
-            key->am_lane = lane;
-        }
-        if ((select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_AM_BW) &&
-            (lane < UCP_MAX_LANES - 1)) {
-            key->am_bw_lanes[lane + 1] = lane;
-        }
-        if (select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_RMA) {
-            key->rma_lanes[lane] = lane;
-        }
-        if (select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_RMA_BW) {
-            key->rma_bw_lanes[lane] = lane;
-        }
-        if (select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_AMO) {
-            key->amo_lanes[lane] = lane;
-        }
-        if (select_ctx->lane_descs[lane].usage & UCP_WIREUP_LANE_USAGE_TAG) {
-            ucs_assert(key->tag_lane == UCP_NULL_LANE);
-            key->tag_lane = lane;
+        usage = select_ctx->lane_descs[lane].usage;
+        ucs_assert(usage != 0);
+
+        /* Route the lane into each usage-class array with conditional
+         * assignments of the same shape, so the compiler emits conditional
+         * moves instead of a chain of data-dependent branches on the usage
+         * mask */
+        ucs_assert(!(usage & UCP_WIREUP_LANE_USAGE_AM) ||
+                   (key->am_lane == UCP_NULL_LANE));
+        ucs_assert(!(usage & UCP_WIREUP_LANE_USAGE_TAG) ||
+                   (key->tag_lane == UCP_NULL_LANE));
+
+        key->am_lane           = (usage & UCP_WIREUP_LANE_USAGE_AM) ?
+                                 lane : key->am_lane;
+        key->tag_lane          = (usage & UCP_WIREUP_LANE_USAGE_TAG) ?
+                                 lane : key->tag_lane;
+        key->rma_lanes[lane]   = (usage & UCP_WIREUP_LANE_USAGE_RMA) ?
+                                 lane : key->rma_lanes[lane];
+        key->rma_bw_lanes[lane] = (usage & UCP_WIREUP_LANE_USAGE_RMA_BW) ?
+                                 lane : key->rma_bw_lanes[lane];
+        key->amo_lanes[lane]   = (usage & UCP_WIREUP_LANE_USAGE_AMO) ?
+                                 lane : key->amo_lanes[lane];
+        if (lane < UCP_MAX_LANES - 1) {
+            key->am_bw_lanes[lane + 1] = (usage & UCP_WIREUP_LANE_USAGE_AM_BW) ?
+                                         lane : key->am_bw_lanes[lane + 1];
         }
     }
 
     /* Sort AM, RMA and AMO lanes according to score */
-    ucs_qsort_r(key->am_bw_lanes + 1, UCP_MAX_LANES - 1, sizeof(ucp_lane_index_t),
-                ucp_wireup_compare_lane_am_bw_score, select_ctx->lane_descs);
-    ucs_qsort_r(key->rma_lanes, UCP_MAX_LANES, sizeof(ucp_lane_index_t),
-                ucp_wireup_compare_lane_rma_score, select_ctx->lane_descs);
-    ucs_qsort_r(key->rma_bw_lanes, UCP_MAX_LANES, sizeof(ucp_lane_index_t),
-                ucp_wireup_compare_lane_rma_bw_score, select_ctx->lane_descs);
-    ucs_qsort_r(key->amo_lanes, UCP_MAX_LANES, sizeof(ucp_lane_index_t),
-                ucp_wireup_compare_lane_amo_score, select_ctx->lane_descs);
+    ucp_wireup_sort_lanes(key->am_bw_lanes + 1, UCP_MAX_LANES - 1,
+                          select_ctx->lane_descs,
+                          ucs_offsetof(ucp_wireup_lane_desc_t, am_bw_score));
+    ucp_wireup_sort_lanes(key->rma_lanes, UCP_MAX_LANES,
+                          select_ctx->lane_descs,
+                          ucs_offsetof(ucp_wireup_lane_desc_t, rma_score));
+    ucp_wireup_sort_lanes(key->rma_bw_lanes, UCP_MAX_LANES,
+                          select_ctx->lane_descs,
+                          ucs_offsetof(ucp_wireup_lane_desc_t, rma_bw_score));
+    ucp_wireup_sort_lanes(key->amo_lanes, UCP_MAX_LANES,
+                          select_ctx->lane_descs,
+                          ucs_offsetof(ucp_wireup_lane_desc_t, amo_score));
 
     /* Select lane for wireup messages */
-    key->wireup_lane =
-        ucp_wireup_select_wireup_msg_lane(worker, select_ctx->params,
-                                          select_ctx->address_list,
-                                          select_ctx->lane_descs,
-                                          key->num_lanes);
+    key->wireup_lane = ucp_wireup_select_wireup_msg_lane(select_ctx,
+                                                         key->num_lanes);
 
     /* add to map first UCP_MAX_OP_MDS fastest MD's */
     for (i = 0;
@@ -1379,12 +2198,12 @@ ucp_wireup_construct_lanes(ucp_wireup_select_ctx_t *select_ctx,
          (ucs_popcount(key->rma_bw_md_map) < UCP_MAX_OP_MDS); i++) {
         lane = key->rma_bw_lanes[i];
         rsc_index = select_ctx->lane_descs[lane].rsc_index;
-        md_index  = context->tl_rscs[rsc_index].md_index;
+        md_index  = select_ctx->tl_rscs[rsc_index].md_index;
 
         /* Pack remote key only if needed for RMA.
          * FIXME a temporary workaround to prevent the ugni uct from using rndv. */
         if ((context->tl_mds[md_index].attr.cap.flags & UCT_MD_FLAG_NEED_RKEY) &&
-            !(strstr(context->tl_rscs[rsc_index].tl_rsc.tl_name, "ugni"))) {
+            !(strstr(select_ctx->tl_rscs[rsc_index].tl_rsc.tl_name, "ugni"))) {
             key->rma_bw_md_map |= UCS_BIT(md_index);
         }
     }
@@ -1403,42 +2222,57 @@ ucs_status_t ucp_wireup_select_lanes(ucp_ep_h ep, const ucp_ep_params_t *params,
     ucs_status_t status;
 
     ucp_wireup_select_ctx_init(&select_ctx, ep, params, ep_init_flags,
-                               address_count, address_list);
+                               address_count, address_list, addr_indices, key);
 
-    status = ucp_wireup_search_lanes(&select_ctx, key);
+    status = ucp_wireup_search_lanes(&select_ctx);
     if (status != UCS_OK) {
         return status;
     }
 
-    ucp_wireup_construct_lanes(&select_ctx, addr_indices, key);
+    ucp_wireup_construct_lanes(&select_ctx, key);
 
     return UCS_OK;
 }
 
-static double ucp_wireup_aux_score_func(ucp_context_h context,
-                                        const uct_md_attr_t *md_attr,
-                                        const uct_iface_attr_t *iface_attr,
-                                        const ucp_address_iface_attr_t *remote_iface_attr)
-{
-    /* best end-to-end latency and larger bcopy size */
-    return (1e-3 / (ucp_wireup_tl_iface_latency(context, iface_attr, remote_iface_attr) +
-            iface_attr->overhead + remote_iface_attr->overhead));
-}
-
 ucs_status_t ucp_wireup_select_aux_transport(ucp_ep_h ep,
                                              const ucp_ep_params_t *params,
                                              const ucp_address_entry_t *address_list,
                                              unsigned address_count,
                                              ucp_wireup_select_info_t *select_info)
 {
-    ucp_wireup_criteria_t criteria = {0};
+    ucp_wireup_criteria_t criteria_buf;
+    const ucp_wireup_criteria_t *criteria;
+
+    /* In the common case the aux criteria are exactly the static template,
+     * so the selector is handed a link-time-constant object and can fold its
+     * fields; only peer error handling needs to patch a stack copy */
+    if (ucp_wireup_ep_params_is_err_mode_peer(params)) {
+        ucp_wireup_fill_aux_criteria(&criteria_buf, params);
+        criteria = &criteria_buf;
+    } else {
+        criteria = &ucp_wireup_aux_criteria_tmpl;
+    }
 
-    ucp_wireup_fill_aux_criteria(&criteria, params);
     return ucp_wireup_select_transport(ep, address_list, address_count,
-                                       &criteria, -1, -1, -1, -1, 1,
+                                       criteria, -1, -1, -1, -1, 1,
                                        select_info);
 }
 
+/* Hash of a destination address, used as the key of the per-context MD
+ * accessibility memo. The packed IPv4 key is exact; other families fold the
+ * address bytes through two crc32 passes. */
+static uint64_t ucp_wireup_sockaddr_hash(const ucs_sock_addr_t *sockaddr)
+{
+    const struct sockaddr *sa = sockaddr->addr;
+
+    if (sa->sa_family == AF_INET) {
+        return ucs_sockaddr_in_key((const struct sockaddr_in*)sa);
+    }
+
+    return ((uint64_t)ucs_crc32(0, sa, sockaddr->addrlen) << 32) |
+           ucs_crc32(UINT32_MAX, sa, sockaddr->addrlen);
+}
+
 ucs_status_t ucp_wireup_select_sockaddr_transport(ucp_ep_h ep,
                                                   const ucp_ep_params_t *params,
                                                   ucp_rsc_index_t *rsc_index_p)
@@ -1449,16 +2283,62 @@ ucs_status_t ucp_wireup_select_sockaddr_transport(ucp_ep_h ep,
     ucp_tl_resource_desc_t *resource;
     ucp_rsc_index_t tl_id;
     ucp_md_index_t md_index;
+    ucp_md_map_t md_bit;
     uct_md_h md;
-    int i;
+    uint64_t sa_hash;
+    unsigned i, idx, start_idx;
+    int accessible;
+    struct ucp_sa_access_cache *cache;
+
+    /* Look up (or allocate round-robin) the accessibility memo entry of this
+     * destination address, so repeated endpoint creation towards the same
+     * listener does not re-probe every MD */
+    sa_hash = ucp_wireup_sockaddr_hash(&params->sockaddr);
+    cache   = NULL;
+    for (i = 0; i < UCP_SA_ACCESS_CACHE_SIZE; i++) {
+        if ((context->config.sockaddr_access_cache[i].md_map_probed != 0) &&
+            (context->config.sockaddr_access_cache[i].sa_hash == sa_hash)) {
+            cache = &context->config.sockaddr_access_cache[i];
+            break;
+        }
+    }
+
+    if (cache == NULL) {
+        cache = &context->config.sockaddr_access_cache[
+                    context->config.sockaddr_access_cache_lru];
+        context->config.sockaddr_access_cache_lru =
+            (context->config.sockaddr_access_cache_lru + 1) %
+            UCP_SA_ACCESS_CACHE_SIZE;
+        cache->sa_hash       = sa_hash;
+        cache->md_map_ok     = 0;
+        cache->md_map_probed = 0;
+    }
+
+    /* The destination address appears in every per-transport failure
+     * message below; render it once, and only if debug logging is enabled
+     * at all (ucs_debug does not evaluate its arguments otherwise) */
+    saddr_str[0] = '\0';
+    if (ucs_log_is_enabled(UCS_LOG_LEVEL_DEBUG)) {
+        ucs_sockaddr_str(params->sockaddr.addr, saddr_str, sizeof(saddr_str));
+    }
+
+    /* Go over the sockaddr transports priority array and try to use the
+     * transports one by one for the client side. The entry which won the
+     * previous selection is probed first - endpoints to the same peer keep
+     * selecting the same transport, so the scan usually stops there. */
+    start_idx = context->config.last_sockaddr_tl_idx;
+    if (start_idx >= context->config.num_sockaddr_tls) {
+        start_idx = 0;
+    }
 
-    /* Go over the sockaddr transports priority array and try to use the transports
-     * one by one for the client side */
     for (i = 0; i < context->config.num_sockaddr_tls; i++) {
-        tl_id    = context->config.sockaddr_tl_ids[i];
+        idx      = (i == 0) ? start_idx :
+                   (i <= start_idx) ? (i - 1) : i;
+        tl_id    = context->config.sockaddr_tl_ids[idx];
         resource = &context->tl_rscs[tl_id];
         md_index = resource->md_index;
         md       = context->tl_mds[md_index].md;
+        md_bit   = UCS_BIT(md_index);
 
         ucs_assert(context->tl_mds[md_index].attr.cap.flags &
                    UCT_MD_FLAG_SOCKADDR);
@@ -1466,17 +2346,27 @@ ucs_status_t ucp_wireup_select_sockaddr_transport(ucp_ep_h ep,
         /* The client selects the transport for sockaddr according to the
          * configuration. We rely on the server having this transport available
          * as well */
-        if (uct_md_is_sockaddr_accessible(md, &params->sockaddr,
-                                          UCT_SOCKADDR_ACC_REMOTE)) {
-            *rsc_index_p = tl_id;
+        if (cache->md_map_probed & md_bit) {
+            accessible = !!(cache->md_map_ok & md_bit);
+        } else {
+            accessible            = uct_md_is_sockaddr_accessible(
+                                        md, &params->sockaddr,
+                                        UCT_SOCKADDR_ACC_REMOTE);
+            cache->md_map_probed |= md_bit;
+            if (accessible) {
+                cache->md_map_ok |= md_bit;
+            }
+        }
+
+        if (accessible) {
+            context->config.last_sockaddr_tl_idx = idx;
+            *rsc_index_p                         = tl_id;
             ucs_debug("sockaddr transport selected: %s", resource->tl_rsc.tl_name);
             return UCS_OK;
         }
 
         ucs_debug("md %s cannot reach %s",
-                  context->tl_mds[md_index].rsc.md_name,
-                  ucs_sockaddr_str(params->sockaddr.addr, saddr_str,
-                                   sizeof(saddr_str)));
+                  context->tl_mds[md_index].rsc.md_name, saddr_str);
     }
 
     return UCS_ERR_UNREACHABLE;
@@ -597,7 +597,7 @@ static ucs_status_t ucp_wireup_msg_handler(void *arg, void *data,
         ucs_bug("invalid wireup message");
     }
 
-    ucs_free(remote_address.address_list);
+    ucp_address_list_release(worker, remote_address.address_list);
 
 out:
     UCS_ASYNC_UNBLOCK(&worker->async);
@@ -826,12 +826,21 @@ ucp_wireup_get_reachable_mds(ucp_worker_h worker, unsigned address_count,
     ucp_rsc_index_t rsc_index;
     ucp_md_index_t dst_md_index;
     ucp_md_map_t ae_dst_md_map, dst_md_map;
+    ucp_worker_iface_t *wiface;
+    uint16_t tl_name_csum;
     unsigned num_dst_mds;
 
     ae_dst_md_map = 0;
     for (rsc_index = 0; rsc_index < context->num_tls; ++rsc_index) {
+        /* Hoist the transport identity compare out of ucp_wireup_is_reachable
+         * so entries of other transports are skipped on the 2-byte checksum
+         * alone, without looking up the worker iface */
+        tl_name_csum = context->tl_rscs[rsc_index].tl_name_csum;
+        wiface       = ucp_worker_iface(worker, rsc_index);
         for (ae = address_list; ae < address_list + address_count; ++ae) {
-            if (ucp_wireup_is_reachable(worker, rsc_index, ae)) {
+            if ((ae->tl_name_csum == tl_name_csum) &&
+                uct_iface_is_reachable(wiface->iface, ae->dev_addr,
+                                       ae->iface_addr)) {
                 ae_dst_md_map         |= UCS_BIT(ae->md_index);
                 dst_md_index           = context->tl_rscs[rsc_index].md_index;
                 ae_cmpts[ae->md_index] = context->tl_mds[dst_md_index].cmpt_index;
@@ -1110,7 +1119,7 @@ static void ucp_wireup_msg_dump(ucp_worker_h worker, uct_am_trace_type_t type,
 
     status = ucp_address_unpack(worker, msg + 1, -1, &unpacked_address);
     if (status != UCS_OK) {
-        strncpy(unpacked_address.name, "<malformed address>", UCP_WORKER_NAME_MAX);
+        unpacked_address.name          = "<malformed address>";
         unpacked_address.uuid          = 0;
         unpacked_address.address_count = 0;
         unpacked_address.address_list  = NULL;
@@ -1148,7 +1157,7 @@ static void ucp_wireup_msg_dump(ucp_worker_h worker, uct_am_trace_type_t type,
         }
     }
 
-    ucs_free(unpacked_address.address_list);
+    ucp_address_list_release(worker, unpacked_address.address_list);
 }
 
 int ucp_worker_iface_is_tl_p2p(const uct_iface_attr_t *iface_attr)
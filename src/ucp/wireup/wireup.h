@@ -32,25 +32,31 @@ enum {
  */
 typedef struct {
     const char  *title;            /* Name of the criteria for debugging */
+    const char  *alloc_title;      /* Criteria name for the allocated-memory
+                                      pass of memory access lane selection */
     uint64_t    local_md_flags;    /* Required local MD flags */
     uint64_t    remote_md_flags;   /* Required remote MD flags */
     uint64_t    local_iface_flags; /* Required local interface flags */
     uint64_t    remote_iface_flags;/* Required remote interface flags */
 
     /**
-     * Calculates score of a potential transport.
+     * Calculates the scores of the candidate remote addresses of one local
+     * resource: fills scores[addr_index] for every address whose bit is set
+     * in addr_map. Dispatched once per resource, so the per-address scoring
+     * formula is a direct (inlinable) call.
      *
      * @param [in]  context      UCP context.
      * @param [in]  md_attr      Local MD attributes.
      * @param [in]  iface_attr   Local interface attributes.
-     * @param [in]  remote_info  Remote peer attributes.
-     *
-     * @return Transport score, the higher the better.
+     * @param [in]  address_list Remote address entries.
+     * @param [in]  addr_map     Bitmap of entries to evaluate.
+     * @param [out] scores       Scores, indexed by address index.
      */
-    double      (*calc_score)(ucp_context_h context,
-                              const uct_md_attr_t *md_attr,
-                              const uct_iface_attr_t *iface_attr,
-                              const ucp_address_iface_attr_t *remote_iface_attr);
+    void        (*calc_score_batch)(ucp_context_h context,
+                                    const uct_md_attr_t *md_attr,
+                                    const uct_iface_attr_t *iface_attr,
+                                    const ucp_address_entry_t *address_list,
+                                    uint64_t addr_map, double *scores);
     uint8_t     tl_rsc_flags; /* Flags that describe TL specifics */
 
     ucp_tl_iface_atomic_flags_t local_atomic_flags;
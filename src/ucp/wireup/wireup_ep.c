@@ -138,7 +138,7 @@ ucs_status_t ucp_wireup_ep_progress_pending(uct_pending_req_t *self)
     status = req->func(req);
     if (status == UCS_OK) {
         ucs_atomic_add32(&wireup_ep->pending_count, -1);
-        ucs_free(proxy_req);
+        ucp_request_put(proxy_req);
     }
     return status;
 }
@@ -160,7 +160,7 @@ ucp_wireup_ep_pending_req_release(uct_pending_req_t *self, void *arg)
         ucs_free(req);
     }
 
-    ucs_free(proxy_req);
+    ucp_request_put(proxy_req);
 }
 
 static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
@@ -176,7 +176,11 @@ static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
 
     UCS_ASYNC_BLOCK(&worker->async);
     if (req->func == ucp_wireup_msg_progress) {
-        proxy_req = ucs_malloc(sizeof(*proxy_req), "ucp_wireup_proxy_req");
+        /* Take the proxy request from the worker's request pool instead of
+         * the heap - pending add/dispatch can churn while the transport is
+         * busy, and the pool hands back a warm object without an allocator
+         * round trip */
+        proxy_req = ucp_request_get(worker);
         if (proxy_req == NULL) {
             status = UCS_ERR_NO_MEMORY;
             goto out;
@@ -194,7 +198,7 @@ static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
         if (status == UCS_OK) {
             ucs_atomic_add32(&wireup_ep->pending_count, +1);
         } else {
-            ucs_free(proxy_req);
+            ucp_request_put(proxy_req);
         }
     } else {
         ucs_queue_push(&wireup_ep->pending_q, ucp_wireup_ep_req_priv(req));
@@ -10,31 +10,25 @@
 #include <stdint.h>
 
 
+/* Use the compiler builtins rather than inline asm: the result is the same
+ * single instruction (TZCNT/LZCNT when the target supports BMI, BSF/BSR
+ * otherwise), but the compiler can constant-fold calls with known arguments
+ * and schedule around the false output dependency. The input must be
+ * non-zero, as with the previous BSF/BSR forms. */
+
 static inline unsigned ucs_ffs64(uint64_t n)
 {
-    uint64_t result;
-    asm("bsfq %1,%0"
-        : "=r" (result)
-        : "r" (n));
-    return result;
+    return __builtin_ctzll(n);
 }
 
 static inline unsigned __ucs_ilog2_u32(uint32_t n)
 {
-    uint32_t result;
-    asm("bsrl %1,%0"
-        : "=r" (result)
-        : "r" (n));
-    return result;
+    return 31 - __builtin_clz(n);
 }
 
 static inline unsigned __ucs_ilog2_u64(uint64_t n)
 {
-    uint64_t result;
-    asm("bsrq %1,%0"
-        : "=r" (result)
-        : "r" (n));
-    return result;
+    return 63 - __builtin_clzll(n);
 }
 
 #endif
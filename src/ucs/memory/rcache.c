@@ -247,6 +247,10 @@ static void ucs_rcache_region_invalidate(ucs_rcache_t *rcache,
 
     ucs_rcache_region_trace(rcache, region, "invalidate");
 
+    if (rcache->last_region == region) {
+        rcache->last_region = NULL;
+    }
+
     /* Remove the memory region from page table, if it's there */
     if (region->flags & UCS_RCACHE_REGION_FLAG_PGTABLE) {
         status = ucs_pgtable_remove(&rcache->pgtable, &region->super);
@@ -354,6 +358,7 @@ static void ucs_rcache_purge(ucs_rcache_t *rcache)
 
     ucs_trace_func("rcache=%s", rcache->name);
 
+    rcache->last_region = NULL;
     ucs_list_head_init(&region_list);
     ucs_pgtable_purge(&rcache->pgtable, ucs_rcache_region_collect_callback,
                       &region_list);
@@ -569,6 +574,7 @@ retry:
     ucs_rcache_region_trace(rcache, region, "created");
 
 out_set_region:
+    rcache->last_region = region;
     *region_p = region;
 out_unlock:
     pthread_rwlock_unlock(&rcache->lock);
@@ -594,6 +600,25 @@ ucs_status_t ucs_rcache_get(ucs_rcache_t *rcache, void *address, size_t length,
     pthread_rwlock_rdlock(&rcache->lock);
     UCS_STATS_UPDATE_COUNTER(rcache->stats, UCS_RCACHE_GETS, 1);
     if (ucs_queue_is_empty(&rcache->inv_q)) {
+        /* Consecutive operations on the same buffer hit the memo of the last
+         * lookup and skip the page table walk. The memo holds no reference -
+         * it is valid because regions leave the page table only in write mode,
+         * which also clears the memo.
+         */
+        region = rcache->last_region;
+        if (ucs_likely((region != NULL) &&
+                       (start >= region->super.start) &&
+                       ((start + length) <= region->super.end) &&
+                       ucs_rcache_region_test(region, prot)))
+        {
+            ucs_rcache_region_hold(rcache, region);
+            ucs_rcache_region_validate_pfn(rcache, region);
+            *region_p = region;
+            UCS_STATS_UPDATE_COUNTER(rcache->stats, UCS_RCACHE_HITS_FAST, 1);
+            pthread_rwlock_unlock(&rcache->lock);
+            return UCS_OK;
+        }
+
         pgt_region = UCS_PROFILE_CALL(ucs_pgtable_lookup, &rcache->pgtable,
                                       start);
         if (ucs_likely(pgt_region != NULL)) {
@@ -601,6 +626,7 @@ ucs_status_t ucs_rcache_get(ucs_rcache_t *rcache, void *address, size_t length,
             if (((start + length) <= region->super.end) &&
                 ucs_rcache_region_test(region, prot))
             {
+                rcache->last_region = region;
                 ucs_rcache_region_hold(rcache, region);
                 ucs_rcache_region_validate_pfn(rcache, region);
                 *region_p = region;
@@ -675,6 +701,8 @@ static UCS_CLASS_INIT_FUNC(ucs_rcache_t, const ucs_rcache_params_t *params,
         goto err_destroy_rwlock;
     }
 
+    self->last_region = NULL;
+
     status = ucs_pgtable_init(&self->pgtable, ucs_rcache_pgt_dir_alloc,
                               ucs_rcache_pgt_dir_release);
     if (status != UCS_OK) {
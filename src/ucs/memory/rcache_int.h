@@ -32,6 +32,13 @@ struct ucs_rcache {
                                           whose refcount is 0 */
     ucs_pgtable_t          pgtable;  /**< page table to hold the regions */
 
+    ucs_rcache_region_t    *last_region; /**< Single-entry memo of the last
+                                          successful lookup. Written under the
+                                          lock (word-sized store, benign race
+                                          between readers), cleared in write
+                                          mode whenever a region is removed
+                                          from the page table */
+
     ucs_spinlock_t         inv_lock; /**< Lock for inv_q and inv_mp. This is a
                                           separate lock because we may want to put
                                           regions on inv_q while the page table
@@ -11,6 +11,9 @@
 #include <ucs/sys/sock.h>
 #include <ucs/sys/math.h>
 #include <ucs/sys/sys.h>
+#include <ucs/type/init_once.h>
+#include <ucs/arch/cpu.h>
+#include <ucs/time/time.h>
 
 #include <unistd.h>
 #include <errno.h>
@@ -23,66 +26,154 @@
 #include <limits.h>
 
 
-#define UCS_SOCKET_MAX_CONN_PATH "/proc/sys/net/core/somaxconn"
+#define UCS_SOCKET_MAX_CONN_PATH    "/proc/sys/net/core/somaxconn"
+#define UCS_NETIF_FLAGS_FMT         "/sys/class/net/%s/flags"
+#define UCS_NETIF_CARRIER_FMT       "/sys/class/net/%s/carrier"
+#define UCS_NETIF_ACTIVE_CACHE_SIZE 8
+#define UCS_NETIF_ACTIVE_CACHE_TTL  ucs_time_from_msec(100.0)
 
 
-typedef ssize_t (*ucs_socket_io_func_t)(int fd, void *data,
-                                        size_t size, int flags);
+/* Memo of recent ucs_netif_is_active results. Device enumeration probes the
+ * same few interfaces repeatedly; a short TTL keeps the file reads and ioctls
+ * to one round per interface per enumeration burst while still noticing link
+ * state changes. Machines have few interfaces, so a linear scan suffices. */
+static struct {
+    char       if_name[IFNAMSIZ];
+    ucs_time_t expiry;
+    int        active;
+} ucs_netif_active_cache[UCS_NETIF_ACTIVE_CACHE_SIZE];
+static unsigned ucs_netif_active_cache_lru = 0;
+
 
 typedef ssize_t (*ucs_socket_iov_func_t)(int fd, const struct msghdr *msg,
                                          int flags);
 
 
-ucs_status_t ucs_netif_ioctl(const char *if_name, unsigned long request,
-                             struct ifreq *if_req)
+ucs_status_t ucs_netif_ioctl_fd(int fd, const char *if_name,
+                                unsigned long request, struct ifreq *if_req)
 {
-    ucs_status_t status;
-    int fd, ret;
-
-    ucs_strncpy_zero(if_req->ifr_name, if_name, sizeof(if_req->ifr_name));
+    int ret;
 
-    status = ucs_socket_create(AF_INET, SOCK_STREAM, &fd);
-    if (status != UCS_OK) {
-        goto out;
-    }
+    /* strncpy_safe copies only the actual name and terminator instead of
+     * zero-filling the whole ifr_name buffer */
+    ucs_strncpy_safe(if_req->ifr_name, if_name, sizeof(if_req->ifr_name));
 
     ret = ioctl(fd, request, if_req);
     if (ret < 0) {
         ucs_debug("ioctl(req=%lu, ifr_name=%s) failed: %m", request, if_name);
-        status = UCS_ERR_IO_ERROR;
-        goto out_close_fd;
+        return UCS_ERR_IO_ERROR;
     }
 
-    status = UCS_OK;
+    return UCS_OK;
+}
+
+ucs_status_t ucs_netif_ioctl(const char *if_name, unsigned long request,
+                             struct ifreq *if_req)
+{
+    ucs_status_t status;
+    int fd;
 
-out_close_fd:
+    status = ucs_socket_create(AF_INET, SOCK_STREAM, &fd);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    status = ucs_netif_ioctl_fd(fd, if_name, request, if_req);
     close(fd);
-out:
     return status;
 }
 
-int ucs_netif_is_active(const char *if_name)
+static int ucs_netif_is_active_uncached(const char *if_name)
 {
     ucs_status_t status;
     struct ifreq ifr;
+    long value;
+    int fd, active;
+
+    /* Test the interface flags from sysfs - one small file read instead of
+     * creating a temporary socket and taking an RTNL-locked ioctl for every
+     * enumerated interface */
+    status = ucs_read_file_number(&value, 1, UCS_NETIF_FLAGS_FMT, if_name);
+    if (status == UCS_OK) {
+        if (!(value & IFF_UP) || (value & IFF_LOOPBACK)) {
+            return 0;
+        }
 
-    status = ucs_netif_ioctl(if_name, SIOCGIFADDR, &ifr);
-    if (status != UCS_OK) {
-        return 0;
+        /* The sysfs flags attribute lacks IFF_RUNNING, which the ioctl
+         * synthesizes from the carrier state - read the carrier attribute
+         * instead (valid here, since the interface is known to be up) */
+        status = ucs_read_file_number(&value, 1, UCS_NETIF_CARRIER_FMT,
+                                      if_name);
+        if ((status != UCS_OK) || (value != 1)) {
+            return 0;
+        }
+
+        /* The interface must also have an address assigned; this ioctl runs
+         * only for interfaces which passed the cheap flags tests above */
+        return ucs_netif_ioctl(if_name, SIOCGIFADDR, &ifr) == UCS_OK;
     }
 
-    status = ucs_netif_ioctl(if_name, SIOCGIFFLAGS, &ifr);
-    if (status != UCS_OK) {
+    /* Fall back to the ioctls if sysfs is not mounted, sharing one socket
+     * between the flags and address queries */
+    if (ucs_socket_create(AF_INET, SOCK_STREAM, &fd) != UCS_OK) {
         return 0;
     }
 
-    return (ifr.ifr_flags & IFF_UP) && (ifr.ifr_flags & IFF_RUNNING) &&
-           !(ifr.ifr_flags & IFF_LOOPBACK);
+    active = (ucs_netif_ioctl_fd(fd, if_name, SIOCGIFFLAGS, &ifr) == UCS_OK) &&
+             (ifr.ifr_flags & IFF_UP) && (ifr.ifr_flags & IFF_RUNNING) &&
+             !(ifr.ifr_flags & IFF_LOOPBACK) &&
+             (ucs_netif_ioctl_fd(fd, if_name, SIOCGIFADDR, &ifr) == UCS_OK);
+    close(fd);
+    return active;
+}
+
+int ucs_netif_is_active(const char *if_name)
+{
+    ucs_time_t now = ucs_get_time();
+    unsigned i, slot;
+    int active;
+
+    slot = ucs_netif_active_cache_lru;
+    for (i = 0; i < UCS_NETIF_ACTIVE_CACHE_SIZE; i++) {
+        if (strncmp(ucs_netif_active_cache[i].if_name, if_name,
+                    IFNAMSIZ) != 0) {
+            continue;
+        }
+
+        if (now < ucs_netif_active_cache[i].expiry) {
+            return ucs_netif_active_cache[i].active;
+        }
+
+        /* Expired entry of the same interface - refresh it in place */
+        slot = i;
+        break;
+    }
+
+    active = ucs_netif_is_active_uncached(if_name);
+
+    if (slot == ucs_netif_active_cache_lru) {
+        ucs_netif_active_cache_lru = (ucs_netif_active_cache_lru + 1) %
+                                     UCS_NETIF_ACTIVE_CACHE_SIZE;
+    }
+
+    /* Invalidate the slot while its fields are rewritten, so a concurrent
+     * reader sees at worst an expired entry and re-probes */
+    ucs_netif_active_cache[slot].expiry = 0;
+    ucs_memory_cpu_store_fence();
+    ucs_strncpy_safe(ucs_netif_active_cache[slot].if_name, if_name, IFNAMSIZ);
+    ucs_netif_active_cache[slot].active = active;
+    ucs_memory_cpu_store_fence();
+    ucs_netif_active_cache[slot].expiry = now + UCS_NETIF_ACTIVE_CACHE_TTL;
+
+    return active;
 }
 
 ucs_status_t ucs_socket_create(int domain, int type, int *fd_p)
 {
-    int fd = socket(domain, type, 0);
+    /* Internal sockets should not leak across exec; requesting the mode at
+     * socket() time also lets callers pass SOCK_NONBLOCK in @a type instead
+     * of following up with fcntl() calls */
+    int fd = socket(domain, type | SOCK_CLOEXEC, 0);
     if (fd < 0) {
         ucs_error("socket create failed: %m");
         return UCS_ERR_IO_ERROR;
@@ -105,45 +196,52 @@ ucs_status_t ucs_socket_setopt(int fd, int level, int optname,
     return UCS_OK;
 }
 
-ucs_status_t ucs_socket_connect(int fd, const struct sockaddr *dest_addr)
+ucs_status_t ucs_socket_connect_sz(int fd, const struct sockaddr *dest_addr,
+                                   socklen_t addr_size)
 {
     char str[UCS_SOCKADDR_STRING_LEN];
     ucs_status_t status;
-    size_t addr_size;
     int ret;
 
-    status = ucs_sockaddr_sizeof(dest_addr, &addr_size);
-    if (status != UCS_OK) {
-        return status;
+    ret = connect(fd, dest_addr, addr_size);
+    if (ret == 0) {
+        /* No %m here - errno is meaningless on the success path */
+        ucs_debug("connect(fd=%d, dest_addr=%s): connected", fd,
+                  ucs_sockaddr_str(dest_addr, str, UCS_SOCKADDR_STRING_LEN));
+        return UCS_OK;
     }
 
-    do {
-        ret = connect(fd, dest_addr, addr_size);
-        if (ret < 0) {
-            if (errno == EINPROGRESS) {
-                status = UCS_INPROGRESS;
-                goto out;
-            }
-
-            if (errno == EISCONN) {
-                status = UCS_ERR_ALREADY_EXISTS;
-                goto out;
-            }
-
-            if (errno != EINTR) {
-                ucs_error("connect(fd=%d, dest_addr=%s) failed: %m", fd,
-                          ucs_sockaddr_str(dest_addr, str, UCS_SOCKADDR_STRING_LEN));
-                return UCS_ERR_UNREACHABLE;
-            }
-        }
-    } while ((ret < 0) && (errno == EINTR));
+    /* A connect() interrupted by a signal is not restartable - the attempt
+     * proceeds asynchronously, exactly like EINPROGRESS, and the caller has
+     * to wait for writability in both cases */
+    if ((errno == EINPROGRESS) || (errno == EINTR)) {
+        status = UCS_INPROGRESS;
+    } else if (errno == EISCONN) {
+        status = UCS_ERR_ALREADY_EXISTS;
+    } else {
+        ucs_error("connect(fd=%d, dest_addr=%s) failed: %m", fd,
+                  ucs_sockaddr_str(dest_addr, str, UCS_SOCKADDR_STRING_LEN));
+        return UCS_ERR_UNREACHABLE;
+    }
 
-out:
     ucs_debug("connect(fd=%d, dest_addr=%s): %m", fd,
               ucs_sockaddr_str(dest_addr, str, UCS_SOCKADDR_STRING_LEN));
     return status;
 }
 
+ucs_status_t ucs_socket_connect(int fd, const struct sockaddr *dest_addr)
+{
+    ucs_status_t status;
+    size_t addr_size;
+
+    status = ucs_sockaddr_sizeof(dest_addr, &addr_size);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    return ucs_socket_connect_sz(fd, dest_addr, addr_size);
+}
+
 ucs_status_t ucs_socket_connect_nb_get_status(int fd)
 {
     socklen_t conn_status_sz;
@@ -173,49 +271,66 @@ ucs_status_t ucs_socket_connect_nb_get_status(int fd)
 
 int ucs_socket_max_conn()
 {
-    static long somaxconn_val = 0;
+    static ucs_init_once_t init_once = UCS_INIT_ONCE_INITIALIZER;
+    static int max_conn              = 0;
+    long somaxconn_val;
+
+    /* Hot path is a single load: a nonzero value was fully computed and
+     * published below, behind a store fence, by whichever thread got there
+     * first */
+    if (ucs_likely(max_conn != 0)) {
+        return max_conn;
+    }
 
-    if (somaxconn_val ||
-        (ucs_read_file_number(&somaxconn_val, 1,
-                              UCS_SOCKET_MAX_CONN_PATH) == UCS_OK)) {
-        ucs_assert(somaxconn_val <= INT_MAX);
-        return somaxconn_val;
-    } else {
-        ucs_warn("unable to read somaxconn value from %s file",
-                 UCS_SOCKET_MAX_CONN_PATH);
-        somaxconn_val = SOMAXCONN;
-        return somaxconn_val;
+    UCS_INIT_ONCE(&init_once) {
+        if (ucs_read_file_number(&somaxconn_val, 1,
+                                 UCS_SOCKET_MAX_CONN_PATH) == UCS_OK) {
+            ucs_assert(somaxconn_val <= INT_MAX);
+        } else {
+            ucs_warn("unable to read somaxconn value from %s file",
+                     UCS_SOCKET_MAX_CONN_PATH);
+            somaxconn_val = SOMAXCONN;
+        }
+
+        ucs_memory_cpu_store_fence();
+        max_conn = somaxconn_val;
     }
+
+    return max_conn;
 }
 
 int ucs_socket_max_iov()
 {
-    static int max_iov = -1;
+    static int max_iov = 0;
+    int value;
 
-#ifdef _SC_IOV_MAX
-    if (max_iov != -1) {
-        return max_iov;
+    value = max_iov;
+    if (ucs_likely(value > 0)) {
+        return value;
     }
 
-    max_iov = sysconf(_SC_IOV_MAX);
-    if (max_iov != -1) {
-        return max_iov;
-    }
-    /* if unable to get value from sysconf(),
-     * use a predefined value */
+#ifdef _SC_IOV_MAX
+    value = (int)sysconf(_SC_IOV_MAX);
+    if (value == -1)
 #endif
-
+    {
+        /* if unable to get value from sysconf(),
+         * use a predefined value */
 #if defined(IOV_MAX)
-    max_iov = IOV_MAX;
+        value = IOV_MAX;
 #elif defined(UIO_MAXIOV)
-    max_iov = UIO_MAXIOV;
+        value = UIO_MAXIOV;
 #else
-    /* The value is used as a fallback when system value is not available.
-     * The latest kernels define it as 1024 */
-    max_iov = 1024;
+        /* The value is used as a fallback when system value is not available.
+         * The latest kernels define it as 1024 */
+        value = 1024;
 #endif
+    }
 
-    return max_iov;
+    /* Concurrent first calls compute the same value, so the plain int store
+     * is an idempotent publish */
+    max_iov = value;
+    return value;
 }
 
 static ucs_status_t
@@ -238,44 +353,61 @@ ucs_socket_handle_io_error(int fd, const char *name, ssize_t io_retval, int io_e
     return UCS_ERR_IO_ERROR;
 }
 
-static inline ucs_status_t
-ucs_socket_do_io_nb(int fd, void *data, size_t *length_p,
-                    ucs_socket_io_func_t io_func, const char *name,
+static UCS_F_ALWAYS_INLINE ucs_status_t
+ucs_socket_do_io_nb(int fd, void *data, size_t *length_p, int is_send,
                     ucs_socket_io_err_cb_t err_cb, void *err_cb_arg)
 {
     ssize_t ret;
 
     ucs_assert(*length_p > 0);
 
-    ret = io_func(fd, data, *length_p, MSG_NOSIGNAL);
+    /* is_send is a compile-time constant at every call site, so the ternary
+     * folds into a direct send()/recv() call instead of an indirect call
+     * through a function pointer */
+    ret = is_send ? send(fd, data, *length_p, MSG_NOSIGNAL) :
+                    recv(fd, data, *length_p, MSG_NOSIGNAL);
     if (ucs_likely(ret > 0)) {
         *length_p = ret;
         return UCS_OK;
     }
 
     *length_p = 0;
-    return ucs_socket_handle_io_error(fd, name, ret, errno,
-                                      err_cb, err_cb_arg);
+    return ucs_socket_handle_io_error(fd, is_send ? "send" : "recv", ret,
+                                      errno, err_cb, err_cb_arg);
 }
 
-static inline ucs_status_t
-ucs_socket_do_io_b(int fd, void *data, size_t length,
-                   ucs_socket_io_func_t io_func, const char *name,
+static UCS_F_ALWAYS_INLINE ucs_status_t
+ucs_socket_do_io_b(int fd, void *data, size_t length, int flags, int is_send,
                    ucs_socket_io_err_cb_t err_cb, void *err_cb_arg)
 {
-    size_t done_cnt = 0, cur_cnt = length;
-    ucs_status_t status;
+    size_t done_cnt = 0;
+    ssize_t ret;
 
+    /* On a blocking socket one syscall normally moves the whole buffer:
+     * send() queues all bytes before returning and MSG_WAITALL makes recv()
+     * fill the buffer, so the loop resumes only after a signal or a short
+     * transfer. The tcp transport also calls this on non-blocking fds, in
+     * which case it keeps spinning on EAGAIN until the full buffer is
+     * transferred, as before. */
     do {
-        status = ucs_socket_do_io_nb(fd, data, &cur_cnt, io_func,
-                                     name, err_cb, err_cb);
-        done_cnt += cur_cnt;
-        ucs_assert(done_cnt <= length);
-        cur_cnt = length - done_cnt;
-    } while ((done_cnt < length) &&
-             ((status == UCS_OK) || (status == UCS_ERR_NO_PROGRESS)));
+        ret = is_send ?
+              send(fd, UCS_PTR_BYTE_OFFSET(data, done_cnt),
+                   length - done_cnt, flags) :
+              recv(fd, UCS_PTR_BYTE_OFFSET(data, done_cnt),
+                   length - done_cnt, flags);
+        if (ucs_likely(ret > 0)) {
+            done_cnt += ret;
+            ucs_assert(done_cnt <= length);
+        } else if ((ret < 0) && ((errno == EINTR) || (errno == EAGAIN) ||
+                                 (errno == EWOULDBLOCK))) {
+            continue;
+        } else {
+            return ucs_socket_handle_io_error(fd, is_send ? "send" : "recv",
+                                              ret, errno, err_cb, err_cb_arg);
+        }
+    } while (done_cnt < length);
 
-    return status;
+    return UCS_OK;
 }
 
 static inline ucs_status_t
@@ -306,34 +438,32 @@ ucs_status_t ucs_socket_send_nb(int fd, const void *data, size_t *length_p,
                                 ucs_socket_io_err_cb_t err_cb,
                                 void *err_cb_arg)
 {
-    return ucs_socket_do_io_nb(fd, (void*)data, length_p,
-                               (ucs_socket_io_func_t)send,
-                               "send", err_cb, err_cb_arg);
+    return ucs_socket_do_io_nb(fd, (void*)data, length_p, 1,
+                               err_cb, err_cb_arg);
 }
 
 ucs_status_t ucs_socket_recv_nb(int fd, void *data, size_t *length_p,
                                 ucs_socket_io_err_cb_t err_cb,
                                 void *err_cb_arg)
 {
-    return ucs_socket_do_io_nb(fd, data, length_p, recv,
-                               "recv", err_cb, err_cb_arg);
+    return ucs_socket_do_io_nb(fd, data, length_p, 0,
+                               err_cb, err_cb_arg);
 }
 
 ucs_status_t ucs_socket_send(int fd, const void *data, size_t length,
                              ucs_socket_io_err_cb_t err_cb,
                              void *err_cb_arg)
 {
-    return ucs_socket_do_io_b(fd, (void*)data, length,
-                              (ucs_socket_io_func_t)send,
-                              "send", err_cb, err_cb_arg);
+    return ucs_socket_do_io_b(fd, (void*)data, length, MSG_NOSIGNAL, 1,
+                              err_cb, err_cb_arg);
 }
 
 ucs_status_t ucs_socket_recv(int fd, void *data, size_t length,
                              ucs_socket_io_err_cb_t err_cb,
                              void *err_cb_arg)
 {
-    return ucs_socket_do_io_b(fd, data, length, recv,
-                              "recv", err_cb, err_cb_arg);
+    return ucs_socket_do_io_b(fd, data, length, MSG_WAITALL, 0,
+                              err_cb, err_cb_arg);
 }
 
 ucs_status_t
@@ -344,106 +474,195 @@ ucs_socket_sendv_nb(int fd, struct iovec *iov, size_t iov_cnt, size_t *length_p,
                                 "sendv", err_cb, err_cb_arg);
 }
 
+ucs_status_t ucs_socket_sendmv_nb(int fd, struct mmsghdr *msgs, unsigned count,
+                                  unsigned *sent_count_p,
+                                  ucs_socket_io_err_cb_t err_cb,
+                                  void *err_cb_arg)
+{
+    int ret;
+
+    ucs_assert(count > 0);
+
+    /* One kernel entry pushes the whole batch, instead of one sendmsg()
+     * per message */
+    ret = sendmmsg(fd, msgs, count, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (ucs_likely(ret > 0)) {
+        *sent_count_p = ret;
+        return ((unsigned)ret == count) ? UCS_OK : UCS_INPROGRESS;
+    }
+
+    *sent_count_p = 0;
+    return ucs_socket_handle_io_error(fd, "sendmmsg", ret, errno,
+                                      err_cb, err_cb_arg);
+}
+
+ucs_status_t ucs_socket_recvmv_nb(int fd, struct mmsghdr *msgs, unsigned count,
+                                  unsigned *recv_count_p,
+                                  ucs_socket_io_err_cb_t err_cb,
+                                  void *err_cb_arg)
+{
+    int ret;
+
+    ucs_assert(count > 0);
+
+    ret = recvmmsg(fd, msgs, count, MSG_DONTWAIT, NULL);
+    if (ucs_likely(ret > 0)) {
+        *recv_count_p = ret;
+        return ((unsigned)ret == count) ? UCS_OK : UCS_INPROGRESS;
+    }
+
+    *recv_count_p = 0;
+    return ucs_socket_handle_io_error(fd, "recvmmsg", ret, errno,
+                                      err_cb, err_cb_arg);
+}
+
+static unsigned ucs_sockaddr_is_known_af(const struct sockaddr *sa)
+{
+    /* bitwise-or of the two tests compiles to a single flag combine with no
+     * conditional branch */
+    return ((sa->sa_family == AF_INET) |
+            (sa->sa_family == AF_INET6));
+}
+
+/* Layout of the known address families, indexed by (sa_family == AF_INET6).
+ * Once the family is validated, the accessors below collapse to an indexed
+ * load of the relevant size/offset instead of a switch. */
+static const struct {
+    uint8_t sa_size;   /* sizeof() the sockaddr structure */
+    uint8_t addr_size; /* Size of the inet address */
+    uint8_t addr_off;  /* Offset of the inet address */
+    uint8_t port_off;  /* Offset of the port, a big-endian uint16_t */
+} ucs_sockaddr_layout[2] = {
+    {sizeof(struct sockaddr_in),  sizeof(struct in_addr),
+     ucs_offsetof(struct sockaddr_in, sin_addr),
+     ucs_offsetof(struct sockaddr_in, sin_port)},
+    {sizeof(struct sockaddr_in6), sizeof(struct in6_addr),
+     ucs_offsetof(struct sockaddr_in6, sin6_addr),
+     ucs_offsetof(struct sockaddr_in6, sin6_port)}
+};
+
 ucs_status_t ucs_sockaddr_sizeof(const struct sockaddr *addr, size_t *size_p)
 {
-    switch (addr->sa_family) {
-    case AF_INET:
-        *size_p = sizeof(struct sockaddr_in);
-        return UCS_OK;
-    case AF_INET6:
-        *size_p = sizeof(struct sockaddr_in6);
-        return UCS_OK;
-    default:
+    if (ucs_unlikely(!ucs_sockaddr_is_known_af(addr))) {
         ucs_error("unknown address family: %d", addr->sa_family);
         return UCS_ERR_INVALID_PARAM;
     }
+
+    *size_p = ucs_sockaddr_layout[addr->sa_family == AF_INET6].sa_size;
+    return UCS_OK;
 }
 
 ucs_status_t ucs_sockaddr_get_port(const struct sockaddr *addr, uint16_t *port_p)
 {
-    switch (addr->sa_family) {
-    case AF_INET:
-        *port_p = ntohs(UCS_SOCKET_INET_PORT(addr));
-        return UCS_OK;
-    case AF_INET6:
-        *port_p = ntohs(UCS_SOCKET_INET6_PORT(addr));
-        return UCS_OK;
-    default:
+    if (ucs_unlikely(!ucs_sockaddr_is_known_af(addr))) {
         ucs_error("unknown address family: %d", addr->sa_family);
         return UCS_ERR_INVALID_PARAM;
     }
+
+    *port_p = ntohs(*(const uint16_t*)UCS_PTR_BYTE_OFFSET(
+                        addr,
+                        ucs_sockaddr_layout[addr->sa_family == AF_INET6]
+                            .port_off));
+    return UCS_OK;
 }
 
 ucs_status_t ucs_sockaddr_set_port(struct sockaddr *addr, uint16_t port)
 {
-    switch (addr->sa_family) {
-    case AF_INET:
-        UCS_SOCKET_INET_PORT(addr) = htons(port);
-        return UCS_OK;
-    case AF_INET6:
-        UCS_SOCKET_INET6_PORT(addr) = htons(port);
-        return UCS_OK;
-    default:
+    if (ucs_unlikely(!ucs_sockaddr_is_known_af(addr))) {
         ucs_error("unknown address family: %d", addr->sa_family);
         return UCS_ERR_INVALID_PARAM;
     }
+
+    *(uint16_t*)UCS_PTR_BYTE_OFFSET(
+        addr,
+        ucs_sockaddr_layout[addr->sa_family == AF_INET6].port_off) =
+        htons(port);
+    return UCS_OK;
 }
 
 const void *ucs_sockaddr_get_inet_addr(const struct sockaddr *addr)
 {
-    switch (addr->sa_family) {
-    case AF_INET:
-        return &UCS_SOCKET_INET_ADDR(addr);
-    case AF_INET6:
-        return &UCS_SOCKET_INET6_ADDR(addr);
-    default:
+    if (ucs_unlikely(!ucs_sockaddr_is_known_af(addr))) {
         ucs_error("unknown address family: %d", addr->sa_family);
         return NULL;
     }
-}
 
-static unsigned ucs_sockaddr_is_known_af(const struct sockaddr *sa)
-{
-    return ((sa->sa_family == AF_INET) ||
-            (sa->sa_family == AF_INET6));
+    return UCS_PTR_BYTE_OFFSET(
+               addr,
+               ucs_sockaddr_layout[addr->sa_family == AF_INET6].addr_off);
 }
 
 const char* ucs_sockaddr_str(const struct sockaddr *sock_addr,
                              char *str, size_t max_size)
 {
+    char port_digits[5];
     uint16_t port;
-    size_t str_len;
+    unsigned num_digits;
+    char *p, *endp;
 
     if (!ucs_sockaddr_is_known_af(sock_addr)) {
-        ucs_strncpy_zero(str, "<invalid address family>", max_size);
+        ucs_strncpy_safe(str, "<invalid address family>", max_size);
         return str;
     }
 
     if (!inet_ntop(sock_addr->sa_family, ucs_sockaddr_get_inet_addr(sock_addr),
                    str, max_size)) {
-        ucs_strncpy_zero(str, "<failed to convert sockaddr to string>", max_size);
+        ucs_strncpy_safe(str, "<failed to convert sockaddr to string>", max_size);
         return str;
     }
 
     if (ucs_sockaddr_get_port(sock_addr, &port) != UCS_OK) {
-        ucs_strncpy_zero(str, "<unable to get port>", max_size);
+        ucs_strncpy_safe(str, "<unable to get port>", max_size);
         return str;
     }
 
-    str_len = strlen(str);
+    /* Append ":<port>" in place. The address length comes from a bounded
+     * scan of the buffer inet_ntop() just filled, and the port digits are
+     * emitted directly, skipping a second full-buffer strlen() and a
+     * variadic snprintf() call. */
+    p          = str + strnlen(str, max_size);
+    endp       = str + max_size - 1;
+    num_digits = 0;
+    do {
+        port_digits[num_digits++] = '0' + (port % 10);
+        port                     /= 10;
+    } while (port != 0);
 
-    ucs_snprintf_zero(str + str_len, max_size - str_len, ":%d", port);
+    if (p < endp) {
+        *(p++) = ':';
+    }
+    while ((num_digits > 0) && (p < endp)) {
+        *(p++) = port_digits[--num_digits];
+    }
+    *p = '\0';
 
     return str;
 }
 
+/* Three-way comparison of two unsigned keys without a branch on the result */
+static UCS_F_ALWAYS_INLINE int ucs_sockaddr_cmp_key(uint64_t key1, uint64_t key2)
+{
+    return (int)(key1 > key2) - (int)(key1 < key2);
+}
+
+/* Load a big-endian value from an unaligned buffer as a host-order integer,
+ * so that numeric comparison of the results is equivalent to memcmp() byte
+ * order on the original buffer */
+static UCS_F_ALWAYS_INLINE uint64_t ucs_sockaddr_load_be64(const void *ptr)
+{
+    uint64_t value;
+
+    memcpy(&value, ptr, sizeof(value));
+    return __builtin_bswap64(value);
+}
+
 int ucs_sockaddr_cmp(const struct sockaddr *sa1,
                      const struct sockaddr *sa2,
                      ucs_status_t *status_p)
 {
     int result          = 1;
     ucs_status_t status = UCS_OK;
-    uint16_t port1, port2;
+    uint64_t key1, key2, lo1, lo2;
 
     if (!ucs_sockaddr_is_known_af(sa1) ||
         !ucs_sockaddr_is_known_af(sa2)) {
@@ -461,25 +680,30 @@ int ucs_sockaddr_cmp(const struct sockaddr *sa1,
 
     switch (sa1->sa_family) {
     case AF_INET:
-        result = memcmp(&UCS_SOCKET_INET_ADDR(sa1),
-                        &UCS_SOCKET_INET_ADDR(sa2),
-                        sizeof(UCS_SOCKET_INET_ADDR(sa1)));
-        port1 = ntohs(UCS_SOCKET_INET_PORT(sa1));
-        port2 = ntohs(UCS_SOCKET_INET_PORT(sa2));
+        /* The packed key resolves address and port ordering in a single
+         * branchless compare instead of memcmp() plus a separate port
+         * branch; the identical family bits do not disturb the order */
+        result = ucs_sockaddr_cmp_key(
+                     ucs_sockaddr_in_key((const struct sockaddr_in*)sa1),
+                     ucs_sockaddr_in_key((const struct sockaddr_in*)sa2));
         break;
     case AF_INET6:
-        result = memcmp(&UCS_SOCKET_INET6_ADDR(sa1),
-                        &UCS_SOCKET_INET6_ADDR(sa2),
-                        sizeof(UCS_SOCKET_INET6_ADDR(sa1)));
-        port1 = ntohs(UCS_SOCKET_INET6_PORT(sa1));
-        port2 = ntohs(UCS_SOCKET_INET6_PORT(sa2));
+        /* Compare the 16 address bytes as two big-endian 64-bit halves and
+         * fall through to the port only when both halves are equal; each
+         * step is a conditional move, not a branch */
+        key1   = ucs_sockaddr_load_be64(&UCS_SOCKET_INET6_ADDR(sa1));
+        key2   = ucs_sockaddr_load_be64(&UCS_SOCKET_INET6_ADDR(sa2));
+        lo1    = ucs_sockaddr_load_be64(UCS_PTR_BYTE_OFFSET(
+                     &UCS_SOCKET_INET6_ADDR(sa1), sizeof(uint64_t)));
+        lo2    = ucs_sockaddr_load_be64(UCS_PTR_BYTE_OFFSET(
+                     &UCS_SOCKET_INET6_ADDR(sa2), sizeof(uint64_t)));
+        result = (key1 != key2) ? ucs_sockaddr_cmp_key(key1, key2) :
+                 (lo1 != lo2)   ? ucs_sockaddr_cmp_key(lo1, lo2) :
+                 ucs_sockaddr_cmp_key(ntohs(UCS_SOCKET_INET6_PORT(sa1)),
+                                      ntohs(UCS_SOCKET_INET6_PORT(sa2)));
         break;
     }
 
-    if (!result && (port1 != port2)) {
-        result = (int)port1 - (int)port2;
-    }
-
 out:
     if (status_p) {
         *status_p = status;
@@ -489,14 +713,15 @@ out:
 
 int ucs_sockaddr_is_inaddr_any(struct sockaddr *addr)
 {
-    switch (addr->sa_family) {
-    case AF_INET:
-        return UCS_SOCKET_INET_ADDR(addr).s_addr == INADDR_ANY;
-    case AF_INET6:
-        return !memcmp(&(UCS_SOCKET_INET6_ADDR(addr)), &in6addr_any,
-                       sizeof(UCS_SOCKET_INET6_ADDR(addr)));
-    default:
+    /* INADDR_ANY and in6addr_any are both all-zero addresses, so a single
+     * length-driven compare covers both families */
+    static const struct in6_addr zero_addr = {{{0}}};
+
+    if (ucs_unlikely(!ucs_sockaddr_is_known_af(addr))) {
         ucs_debug("invalid address family: %d", addr->sa_family);
         return 0;
     }
+
+    return !memcmp(ucs_sockaddr_get_inet_addr(addr), &zero_addr,
+                   ucs_sockaddr_layout[addr->sa_family == AF_INET6].addr_size);
 }
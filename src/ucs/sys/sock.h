@@ -9,6 +9,7 @@
 #define UCS_SOCKET_H
 
 #include <ucs/type/status.h>
+#include <ucs/sys/compiler_def.h>
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -30,14 +31,60 @@ BEGIN_C_DECLS
 #define UCS_SOCKET_INET6_PORT(_addr) (((struct sockaddr_in6*)(_addr))->sin6_port)
 
 
+/**
+ * Pack an IPv4 sockaddr into a single 64-bit comparison key: the family,
+ * byte-order-normalized address and port occupy disjoint bit ranges, so keys
+ * are equal exactly when the addresses are equal, and the numeric order of
+ * keys matches ucs_sockaddr_cmp() ordering. Intended for sockaddr-keyed hash
+ * tables, where one integer compare/hash replaces a struct-wide memcmp/crc.
+ *
+ * @param [in]  sa  Pointer to an IPv4 sockaddr.
+ *
+ * @return 64-bit comparison key.
+ */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucs_sockaddr_in_key(const struct sockaddr_in *sa)
+{
+    uint32_t s_addr;
+
+    memcpy(&s_addr, &sa->sin_addr, sizeof(s_addr));
+    return ((uint64_t)sa->sin_family << 48) |
+           ((uint64_t)__builtin_bswap32(s_addr) << 16) |
+           ntohs(sa->sin_port);
+}
+
+
+/* Multi-message header for the batched send/recv helpers; visible from
+ * <sys/socket.h> only under _GNU_SOURCE, so declare it for other users of
+ * this header */
+struct mmsghdr;
+
+
 /* Returns `UCS_ERR_NO_PROGRESS` if the default error
  * handling should be done, otherwise `UCS_OK` */
 typedef ucs_status_t (*ucs_socket_io_err_cb_t)(void *arg, int io_errno);
 
 
 /**
- * Perform an ioctl call on the given interface with the given request.
- * Set the result in the ifreq struct.
+ * Perform an ioctl call on the given interface with the given request,
+ * using an already-created socket. Set the result in the ifreq struct.
+ *
+ * @param [in]  fd           Socket fd to issue the ioctl on.
+ * @param [in]  if_name      Interface name to test.
+ * @param [in]  request      The request to fulfill.
+ * @param [out] if_req       Filled with the requested information.
+ *
+ * @return UCS_OK on success or an error code on failure.
+ */
+ucs_status_t ucs_netif_ioctl_fd(int fd, const char *if_name,
+                                unsigned long request, struct ifreq *if_req);
+
+
+/**
+ * Perform an ioctl call on the given interface with the given request,
+ * creating (and closing) a socket for the call. Callers issuing several
+ * requests for the same interface should create the socket once and use
+ * @ref ucs_netif_ioctl_fd instead. Set the result in the ifreq struct.
  *
  * @param [in]  if_name      Interface name to test.
  * @param [in]  request      The request to fulfill.
@@ -63,7 +110,9 @@ int ucs_netif_is_active(const char *if_name);
  * Create a socket.
  *
  * @param [in]   domain     Communication domain (AF_INET/AF_INET6/etc).
- * @param [in]   type       Communication semantics (SOCK_STREAM/SOCK_DGRAM/etc).
+ * @param [in]   type       Communication semantics (SOCK_STREAM/SOCK_DGRAM/etc),
+ *                          optionally or'd with behavior flags such as
+ *                          SOCK_NONBLOCK. SOCK_CLOEXEC is always applied.
  * @param [out]  fd_p       Pointer to created fd.
  *
  * @return UCS_OK on success or UCS_ERR_IO_ERROR on failure.
@@ -90,7 +139,24 @@ ucs_status_t ucs_socket_setopt(int fd, int level, int optname,
 
 /**
  * Connect the socket referred to by the file descriptor `fd`
- * to the address specified by `dest_addr`.
+ * to the address specified by `dest_addr`, whose length is already
+ * known to the caller.
+ *
+ * @param [in]  fd                Socket fd.
+ * @param [in]  dest_addr         Pointer to destination address.
+ * @param [in]  addr_size         Size of the destination address.
+ *
+ * @return UCS_OK on success or UCS_ERR_UNREACHABLE on failure or
+ *         UCS_INPROGRESS if operation is in progress.
+ */
+ucs_status_t ucs_socket_connect_sz(int fd, const struct sockaddr *dest_addr,
+                                   socklen_t addr_size);
+
+
+/**
+ * Connect the socket referred to by the file descriptor `fd`
+ * to the address specified by `dest_addr`, deriving the address length
+ * from the address family.
  *
  * @param [in]  fd                Socket fd.
  * @param [in]  dest_addr         Pointer to destination address.
@@ -220,6 +286,59 @@ ucs_status_t ucs_socket_sendv_nb(int fd, struct iovec *iov, size_t iov_cnt,
                                  void *err_cb_arg);
 
 
+/**
+ * Non-blocking send operation transmits a batch of messages on the connected
+ * socket referred to by the file descriptor `fd` in a single system call.
+ *
+ * @param [in]      fd              Socket fd.
+ * @param [in]      msgs            A pointer to an array of message headers;
+ *                                  the msg_len field of each sent message is
+ *                                  updated with the transmitted size.
+ * @param [in]      count           The number of messages pointed to by
+ *                                  the msgs parameter.
+ * @param [out]     sent_count_p    The number of fully sent messages is
+ *                                  written to this argument.
+ * @param [in]      err_cb          Error callback.
+ * @param [in]      err_cb_arg      User's argument for the error callback.
+ *
+ * @return UCS_OK if all messages were sent, UCS_INPROGRESS if only a prefix
+ *         of the batch was sent, UCS_ERR_CANCELED if connection closed,
+ *         UCS_ERR_NO_PROGRESS if system call was interrupted or
+ *         would block, UCS_ERR_IO_ERROR on failure.
+ */
+ucs_status_t ucs_socket_sendmv_nb(int fd, struct mmsghdr *msgs, unsigned count,
+                                  unsigned *sent_count_p,
+                                  ucs_socket_io_err_cb_t err_cb,
+                                  void *err_cb_arg);
+
+
+/**
+ * Non-blocking receive operation receives a batch of messages from the
+ * connected socket referred to by the file descriptor `fd` in a single
+ * system call.
+ *
+ * @param [in]      fd              Socket fd.
+ * @param [in]      msgs            A pointer to an array of message headers;
+ *                                  the msg_len field of each received message
+ *                                  is updated with the received size.
+ * @param [in]      count           The number of messages pointed to by
+ *                                  the msgs parameter.
+ * @param [out]     recv_count_p    The number of received messages is written
+ *                                  to this argument.
+ * @param [in]      err_cb          Error callback.
+ * @param [in]      err_cb_arg      User's argument for the error callback.
+ *
+ * @return UCS_OK if the whole batch was received, UCS_INPROGRESS if only a
+ *         prefix of the batch was received, UCS_ERR_CANCELED if connection
+ *         closed, UCS_ERR_NO_PROGRESS if system call was interrupted or
+ *         would block, UCS_ERR_IO_ERROR on failure.
+ */
+ucs_status_t ucs_socket_recvmv_nb(int fd, struct mmsghdr *msgs, unsigned count,
+                                  unsigned *recv_count_p,
+                                  ucs_socket_io_err_cb_t err_cb,
+                                  void *err_cb_arg);
+
+
 /**
  * Blocking receive operation receives data from the connected (or bound
  * connectionless) socket referred to by the file descriptor `fd`.
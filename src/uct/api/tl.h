@@ -27,9 +27,27 @@ BEGIN_C_DECLS
  * Transport interface operations.
  * Every operation exposed in the API should appear in the table below, to allow
  * creating interface/endpoint with custom operations.
+ *
+ * This table is embedded at offset 0 of every interface, so the first eight
+ * entries share the cache line the dispatching ep->iface load brings in; the
+ * most frequent operations (active messages, then put/get) are kept there.
  */
 typedef struct uct_iface_ops {
 
+    /* endpoint - active message */
+
+    ucs_status_t (*ep_am_short)(uct_ep_h ep, uint8_t id, uint64_t header,
+                                const void *payload, unsigned length);
+
+    ssize_t      (*ep_am_bcopy)(uct_ep_h ep, uint8_t id,
+                                uct_pack_callback_t pack_cb, void *arg,
+                                unsigned flags);
+
+    ucs_status_t (*ep_am_zcopy)(uct_ep_h ep, uint8_t id, const void *header,
+                                unsigned header_length, const uct_iov_t *iov,
+                                size_t iovcnt, unsigned flags,
+                                uct_completion_t *comp);
+
     /* endpoint - put */
 
     ucs_status_t (*ep_put_short)(uct_ep_h ep, const void *buffer, unsigned length,
@@ -56,20 +74,6 @@ typedef struct uct_iface_ops {
                                  uint64_t remote_addr, uct_rkey_t rkey,
                                  uct_completion_t *comp);
 
-    /* endpoint - active message */
-
-    ucs_status_t (*ep_am_short)(uct_ep_h ep, uint8_t id, uint64_t header,
-                                const void *payload, unsigned length);
-
-    ssize_t      (*ep_am_bcopy)(uct_ep_h ep, uint8_t id,
-                                uct_pack_callback_t pack_cb, void *arg,
-                                unsigned flags);
-
-    ucs_status_t (*ep_am_zcopy)(uct_ep_h ep, uint8_t id, const void *header,
-                                unsigned header_length, const uct_iov_t *iov,
-                                size_t iovcnt, unsigned flags,
-                                uct_completion_t *comp);
-
     /* endpoint - atomics */
 
     ucs_status_t (*ep_atomic_cswap64)(uct_ep_h ep, uint64_t compare, uint64_t swap,
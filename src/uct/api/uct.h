@@ -1014,7 +1014,11 @@ struct uct_ep_params {
     uct_iface_h                       iface;
 
     /**
-     * User data associated with the endpoint.
+     * User data associated with the endpoint. The connection manager callbacks
+     * may be invoked with this pointer concurrently for different endpoints;
+     * when per-endpoint contexts are written from such callbacks, allocating
+     * them cache-line aligned (and padded) avoids false sharing between
+     * neighboring contexts during connect/disconnect bursts.
      */
     void                              *user_data;
 
@@ -1249,6 +1253,11 @@ struct uct_completion {
  *
  * This structure should be passed to @ref uct_ep_pending_add() and is used to signal
  * new available resources back to user.
+ *
+ * The request is intrusive: transports keep their queue or arbiter linkage
+ * inside @a priv (each use is guarded by a compile-time size check), so adding
+ * a request to a pending queue never allocates memory. The storage belongs to
+ * the caller, who typically embeds the request in a pooled object.
  */
 struct uct_pending_req {
     uct_pending_callback_t    func;   /**< User callback function */
@@ -1303,7 +1312,10 @@ struct uct_tag_context {
      void (*rndv_cb)(uct_tag_context_t *self, uct_tag_t stag, const void *header,
                      unsigned header_length, ucs_status_t status);
 
-     /** A placeholder for the private data used by the transport */
+     /** A placeholder for the private data used by the transport.
+      *  Transports access this area in place by casting it to their own
+      *  context type (guarded by a compile-time size check) - it is never
+      *  copied on the fast path. */
      char priv[UCT_TAG_PRIV_LEN];
 };
 
@@ -161,7 +161,12 @@ enum uct_cm_remote_data_field {
     UCT_CM_REMOTE_DATA_FIELD_CONN_PRIV_DATA        = UCS_BIT(2),
 
     /** Enables @ref uct_cm_remote_data::conn_priv_data_length */
-    UCT_CM_REMOTE_DATA_FIELD_CONN_PRIV_DATA_LENGTH = UCS_BIT(3)
+    UCT_CM_REMOTE_DATA_FIELD_CONN_PRIV_DATA_LENGTH = UCS_BIT(3),
+
+    /** All fields above. Connection managers which deliver the complete
+     *  remote data set this value, so a consumer interested in all fields
+     *  can test the whole mask at once instead of checking bit by bit. */
+    UCT_CM_REMOTE_DATA_FIELD_ALL                   = UCS_MASK(4)
 };
 
 
@@ -212,6 +217,13 @@ typedef struct uct_cm_remote_data {
  * a descriptor which must be released later by @ref uct_iface_release_desc by
  * the user if the callback returns @ref UCS_INPROGRESS.
  *
+ * Returning @ref UCS_INPROGRESS is the zero-copy handoff of this API: the
+ * consumer keeps the transport's receive descriptor instead of copying the
+ * payload out, and releases it once the data has been processed or forwarded.
+ * Transports which cannot hand over their receive buffer (for example when it
+ * holds more than one message) invoke the callback without
+ * @ref UCT_CB_PARAM_FLAG_DESC, which mandates a synchronous copy.
+ *
  * @param [in]  arg      User-defined argument.
  * @param [in]  data     Points to the received data. This may be a part of
  *                       a descriptor which may be released later.
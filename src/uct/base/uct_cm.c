@@ -77,6 +77,11 @@ static ucs_stats_class_t uct_cm_stats_class = {
 UCS_CLASS_INIT_FUNC(uct_cm_t, uct_cm_ops_t* ops, uct_iface_ops_t* iface_ops,
                     uct_worker_h worker, uct_component_h component)
 {
+    /* Connection manager callbacks pass uct_cm_remote_data_t around by
+     * pointer; keep it within a single cache line so a callback reads the
+     * whole descriptor with one line fill */
+    UCS_STATIC_ASSERT(sizeof(uct_cm_remote_data_t) <= UCS_SYS_CACHE_LINE_SIZE);
+
     self->ops                     = ops;
     self->component               = component;
     self->iface.super.ops         = *iface_ops;
@@ -84,7 +89,7 @@ UCS_CLASS_INIT_FUNC(uct_cm_t, uct_cm_ops_t* ops, uct_iface_ops_t* iface_ops,
 
     self->iface.md                = NULL;
     self->iface.am->arg           = NULL;
-    self->iface.am->flags         = 0;
+    self->iface.am_flags[0]       = 0;
     self->iface.am->cb            = (void *)ucs_empty_function_return_unsupported;
     self->iface.am_tracer         = NULL;
     self->iface.am_tracer_arg     = NULL;
@@ -66,9 +66,9 @@ static ucs_status_t uct_iface_stub_am_handler(void *arg, void *data,
 
 static void uct_iface_set_stub_am_handler(uct_base_iface_t *iface, uint8_t id)
 {
-    iface->am[id].cb    = uct_iface_stub_am_handler;
-    iface->am[id].arg   = (void*)(uintptr_t)id;
-    iface->am[id].flags = UCT_CB_FLAG_ASYNC;
+    iface->am[id].cb     = uct_iface_stub_am_handler;
+    iface->am[id].arg    = (void*)(uintptr_t)id;
+    iface->am_flags[id]  = UCT_CB_FLAG_ASYNC;
 }
 
 ucs_status_t uct_iface_set_am_handler(uct_iface_h tl_iface, uint8_t id,
@@ -107,7 +107,7 @@ ucs_status_t uct_iface_set_am_handler(uct_iface_h tl_iface, uint8_t id,
 
     iface->am[id].cb    = cb;
     iface->am[id].arg   = arg;
-    iface->am[id].flags = flags;
+    iface->am_flags[id] = flags;
     return UCS_OK;
 }
 
@@ -11,6 +11,7 @@
 
 #include <uct/api/uct.h>
 #include <uct/base/uct_component.h>
+#include <ucs/arch/cpu.h>
 #include <ucs/config/parser.h>
 #include <ucs/datastruct/arbiter.h>
 #include <ucs/datastruct/mpool.h>
@@ -187,10 +188,12 @@ UCS_CLASS_DECLARE(uct_ep_t, uct_iface_h);
 /**
  * Active message handle table entry
  */
+/* Only the fields read per incoming message live here, so an entry is
+ * exactly 16 bytes and four entries share a cache line; registration flags
+ * are kept in a separate table next to it */
 typedef struct uct_am_handler {
     uct_am_callback_t cb;
     void              *arg;
-    uint32_t          flags;
 } uct_am_handler_t;
 
 
@@ -202,7 +205,10 @@ typedef struct uct_base_iface {
     uct_iface_t             super;
     uct_md_h                md;               /* MD this interface is using */
     uct_priv_worker_t       *worker;          /* Worker this interface is on */
-    uct_am_handler_t        am[UCT_AM_ID_MAX];/* Active message table */
+    uct_am_handler_t        am[UCT_AM_ID_MAX] /* Active message table */
+                            UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE);
+    uint32_t                am_flags[UCT_AM_ID_MAX]; /* AM handler flags,
+                                                        off the dispatch path */
     uct_am_tracer_t         am_tracer;        /* Active message tracer */
     void                    *am_tracer_arg;   /* Tracer argument */
     uct_error_handler_t     err_handler;      /* Error handler */
@@ -536,7 +542,12 @@ typedef struct {
  */
 #define uct_iface_trace_am(_iface, _type, _am_id, _payload, _length, _fmt, ...) \
     if (ucs_log_is_enabled(UCS_LOG_LEVEL_TRACE_DATA)) { \
-        char buf[256] = {0}; \
+        char buf[256]; \
+        \
+        /* Tracers null-terminate whatever they format; only the no-tracer \
+         * case needs an empty string, so avoid zeroing the whole buffer on \
+         * every traced message */ \
+        buf[0] = '\0'; \
         uct_iface_dump_am(_iface, _type, _am_id, _payload, _length, \
                           buf, sizeof(buf) - 1); \
         ucs_trace_data(_fmt " am_id %d len %zu %s", ## __VA_ARGS__, \
@@ -659,7 +670,9 @@ size_t uct_iov_get_length(const uct_iov_t *iov)
 }
 
 /**
- * Calculates total length of the iov array buffers.
+ * Calculates total length of the iov array buffers. Used by parameter checks,
+ * statistics and tracing; data paths fuse the summation into their fill loops
+ * instead of walking the iov twice.
  */
 static UCS_F_ALWAYS_INLINE
 size_t uct_iov_total_length(const uct_iov_t *iov, size_t iovcnt)
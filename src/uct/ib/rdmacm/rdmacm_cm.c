@@ -189,10 +189,7 @@ static void uct_rdmacm_cm_handle_event_connect_request(struct rdma_cm_event *eve
         return;
     }
 
-    remote_data.field_mask            = UCT_CM_REMOTE_DATA_FIELD_DEV_ADDR        |
-                                        UCT_CM_REMOTE_DATA_FIELD_DEV_ADDR_LENGTH |
-                                        UCT_CM_REMOTE_DATA_FIELD_CONN_PRIV_DATA  |
-                                        UCT_CM_REMOTE_DATA_FIELD_CONN_PRIV_DATA_LENGTH;
+    remote_data.field_mask            = UCT_CM_REMOTE_DATA_FIELD_ALL;
     remote_data.dev_addr              = dev_addr;
     remote_data.dev_addr_length       = addr_length;
     remote_data.conn_priv_data        = hdr + 1;
@@ -27,7 +27,8 @@ ucs_status_t uct_sockcm_ep_set_sock_id(uct_sockcm_ep_t *ep)
     ep->sock_id_ctx->handler_added = 0;
     dest_addr = (struct sockaddr *) &(ep->remote_addr);
 
-    status = ucs_socket_create(dest_addr->sa_family, SOCK_STREAM,
+    status = ucs_socket_create(dest_addr->sa_family,
+                               SOCK_STREAM | SOCK_NONBLOCK,
                                &ep->sock_id_ctx->sock_id);
     if (status != UCS_OK) {
         ucs_debug("unable to create client socket for sockcm");
@@ -101,12 +102,8 @@ static UCS_CLASS_INIT_FUNC(uct_sockcm_ep_t, const uct_ep_params_t *params)
         goto err;
     }
 
-    status = ucs_sys_fcntl_modfl(self->sock_id_ctx->sock_id, O_NONBLOCK, 0); 
-    if (status != UCS_OK) {
-        goto sock_err;
-    }
-
-    status = ucs_socket_connect(self->sock_id_ctx->sock_id, param_sockaddr);
+    status = ucs_socket_connect_sz(self->sock_id_ctx->sock_id, param_sockaddr,
+                                   sockaddr_len);
     if (UCS_STATUS_IS_ERR(status)) {
         ucs_debug("%d: connect fail\n", self->sock_id_ctx->sock_id);
         self->conn_state = UCT_SOCKCM_EP_CONN_STATE_CLOSED;
@@ -93,25 +93,18 @@ typedef unsigned (*uct_tcp_ep_progress_t)(uct_tcp_ep_t *ep);
 static inline int uct_tcp_khash_sockaddr_in_equal(struct sockaddr_in sa1,
                                                   struct sockaddr_in sa2)
 {
-    ucs_status_t status;
-    int cmp;
-
-    cmp = ucs_sockaddr_cmp((const struct sockaddr*)&sa1,
-                           (const struct sockaddr*)&sa2,
-                           &status);
-    ucs_assert(status == UCS_OK);
-    return !cmp;
+    /* The packed keys cover family, address and port - everything the full
+     * sockaddr compare would look at for AF_INET */
+    return ucs_sockaddr_in_key(&sa1) == ucs_sockaddr_in_key(&sa2);
 }
 
 static inline uint32_t uct_tcp_khash_sockaddr_in_hash(struct sockaddr_in sa)
 {
-    ucs_status_t UCS_V_UNUSED status;
-    size_t addr_size;
+    uint64_t key = ucs_sockaddr_in_key(&sa);
 
-    status = ucs_sockaddr_sizeof((const struct sockaddr*)&sa,
-                                 &addr_size);
-    ucs_assert(status == UCS_OK);
-    return ucs_crc32(0, (const void *)&sa, addr_size);
+    /* Hash the 8-byte key instead of the whole structure, which includes
+     * the sin_zero padding bytes */
+    return ucs_crc32(0, &key, sizeof(key));
 }
 
 KHASH_INIT(uct_tcp_cm_eps, struct sockaddr_in, ucs_list_link_t*,
@@ -555,7 +555,9 @@ ucs_status_t uct_tcp_cm_conn_start(uct_tcp_ep_t *ep)
     uint32_t req_events;
     ucs_status_t status;
 
-    status = ucs_socket_connect(ep->fd, (const struct sockaddr*)&ep->peer_addr);
+    status = ucs_socket_connect_sz(ep->fd,
+                                   (const struct sockaddr*)&ep->peer_addr,
+                                   sizeof(ep->peer_addr));
     if (status == UCS_INPROGRESS) {
         new_conn_state  = UCT_TCP_EP_CONN_STATE_CONNECTING;
         req_events      = UCS_EVENT_SET_EVWRITE;
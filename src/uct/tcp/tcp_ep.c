@@ -172,11 +172,8 @@ static UCS_CLASS_INIT_FUNC(uct_tcp_ep_t, uct_tcp_iface_t *iface,
     ucs_list_head_init(&self->list);
     ucs_queue_head_init(&self->pending_q);
 
-    status = ucs_sys_fcntl_modfl(self->fd, O_NONBLOCK, 0);
-    if (status != UCS_OK) {
-        goto err_cleanup;
-    }
-
+    /* Both connecting and accepted fds are created in non-blocking mode, so
+     * no fcntl() round trip is needed here */
     status = uct_tcp_iface_set_sockopt(iface, self->fd);
     if (status != UCS_OK) {
         goto err_cleanup;
@@ -345,7 +342,7 @@ static ucs_status_t uct_tcp_ep_create_connected(uct_tcp_iface_t *iface,
     uct_tcp_ep_t *ep;
     int fd;
 
-    status = ucs_socket_create(AF_INET, SOCK_STREAM, &fd);
+    status = ucs_socket_create(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, &fd);
     if (status != UCS_OK) {
         return status;
     }
@@ -691,9 +688,15 @@ unsigned uct_tcp_ep_progress_rx(uct_tcp_ep_t *ep)
     } else {
         ucs_assert(ep->rx.buf != NULL);
 
-        /* do partial receive of the remaining user data */
-        hdr         = ep->rx.buf + ep->rx.offset;
-        recv_length = hdr->length - (ep->rx.length - ep->rx.offset - sizeof(*hdr));
+        /* move the partially received message to the beginning of the buffer
+         * and post the rest of the buffer behind it, so that one recv brings
+         * in the remainder of this message together with any small messages
+         * queued behind it, instead of one syscall per message */
+        remainder = ep->rx.length - ep->rx.offset;
+        memmove(ep->rx.buf, ep->rx.buf + ep->rx.offset, remainder);
+        ep->rx.offset = 0;
+        ep->rx.length = remainder;
+        recv_length   = (2 * iface->config.rx_seg_size) - remainder;
     }
 
     if (!uct_tcp_ep_recv(ep, recv_length)) {
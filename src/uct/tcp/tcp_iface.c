@@ -253,7 +253,11 @@ static void uct_tcp_iface_connect_handler(int listen_fd, void *arg)
     for (;;) {
         addrlen = sizeof(peer_addr);
 
-        fd = accept(iface->listen_fd, (struct sockaddr*)&peer_addr, &addrlen);
+        /* Accepted fds are switched to non-blocking mode and marked
+         * close-on-exec as part of the same syscall, instead of separate
+         * fcntl() calls afterwards */
+        fd = accept4(iface->listen_fd, (struct sockaddr*)&peer_addr, &addrlen,
+                     SOCK_NONBLOCK | SOCK_CLOEXEC);
         if (fd < 0) {
             if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
                 ucs_error("accept() failed: %m");
@@ -334,18 +338,14 @@ static ucs_status_t uct_tcp_iface_listener_init(uct_tcp_iface_t *iface)
     ucs_status_t status;
     int ret;
 
-    /* Create the server socket for accepting incoming connections */
-    status = ucs_socket_create(AF_INET, SOCK_STREAM, &iface->listen_fd);
+    /* Create the server socket for accepting incoming connections, in
+     * non-blocking mode */
+    status = ucs_socket_create(AF_INET, SOCK_STREAM | SOCK_NONBLOCK,
+                               &iface->listen_fd);
     if (status != UCS_OK) {
         return status;
     }
 
-    /* Set the server socket to non-blocking mode */
-    status = ucs_sys_fcntl_modfl(iface->listen_fd, O_NONBLOCK, 0);
-    if (status != UCS_OK) {
-        goto err_close_sock;
-    }
-
     /* Loop until unused port found */
     do {
         /* Bind socket to random available port */
@@ -19,6 +19,7 @@
 #include <net/if_arp.h>
 #include <net/if.h>
 #include <netdb.h>
+#include <unistd.h>
 
 
 typedef ssize_t (*uct_tcp_io_func_t)(int fd, void *data, size_t size, int flags);
@@ -34,13 +35,20 @@ ucs_status_t uct_tcp_netif_caps(const char *if_name, double *latency_p,
     size_t ll_headers;
     int speed_known;
     short ether_type;
+    int fd;
 
     memset(&ifr, 0, sizeof(ifr));
 
+    /* One socket serves all three interface queries below */
+    if (ucs_socket_create(AF_INET, SOCK_STREAM, &fd) != UCS_OK) {
+        fd = -1;
+    }
+
     speed_known  = 0;
     edata.cmd    = ETHTOOL_GSET;
     ifr.ifr_data = (void*)&edata;
-    status = ucs_netif_ioctl(if_name, SIOCETHTOOL, &ifr);
+    status = (fd < 0) ? UCS_ERR_IO_ERROR :
+             ucs_netif_ioctl_fd(fd, if_name, SIOCETHTOOL, &ifr);
     if (status == UCS_OK) {
 #if HAVE_DECL_ETHTOOL_CMD_SPEED
         speed_mbps = ethtool_cmd_speed(&edata);
@@ -59,20 +67,26 @@ ucs_status_t uct_tcp_netif_caps(const char *if_name, double *latency_p,
         ucs_debug("speed of %s is UNKNOWN, assuming %d Mbps", if_name, speed_mbps);
     }
 
-    status = ucs_netif_ioctl(if_name, SIOCGIFHWADDR, &ifr);
+    status = (fd < 0) ? UCS_ERR_IO_ERROR :
+             ucs_netif_ioctl_fd(fd, if_name, SIOCGIFHWADDR, &ifr);
     if (status == UCS_OK) {
         ether_type = ifr.ifr_addr.sa_family;
     } else {
         ether_type = ARPHRD_ETHER;
     }
 
-    status = ucs_netif_ioctl(if_name, SIOCGIFMTU, &ifr);
+    status = (fd < 0) ? UCS_ERR_IO_ERROR :
+             ucs_netif_ioctl_fd(fd, if_name, SIOCGIFMTU, &ifr);
     if (status == UCS_OK) {
         *mtu_p = ifr.ifr_mtu;
     } else {
         *mtu_p = 1500;
     }
 
+    if (fd >= 0) {
+        close(fd);
+    }
+
     switch (ether_type) {
     case ARPHRD_ETHER:
         /* https://en.wikipedia.org/wiki/Ethernet_frame */
@@ -404,7 +404,7 @@ UCS_TEST_P(test_ucp_wireup_1sided, address) {
 
     /* TODO test addresses */
 
-    ucs_free(unpacked_address.address_list);
+    ucp_address_list_release(sender().worker(), unpacked_address.address_list);
     ucs_free(buffer);
     /* Make sure that the packed device priorities are equal to the unpacked
      * device priorities */
@@ -436,7 +436,7 @@ UCS_TEST_P(test_ucp_wireup_1sided, empty_address) {
 #endif
     EXPECT_EQ(0u, unpacked_address.address_count);
 
-    ucs_free(unpacked_address.address_list);
+    ucp_address_list_release(sender().worker(), unpacked_address.address_list);
     ucs_free(buffer);
 }
 